@@ -44,6 +44,7 @@
 #endif
 
 #include "native_type.h"
+#include "native_render.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -1375,6 +1376,173 @@ int32_t OH_ArkUI_TransitionEffect_Combine(
  */
 int32_t OH_ArkUI_TransitionEffect_SetAnimation(
     ArkUI_TransitionEffect* effect, ArkUI_AnimateOption* animation);
+
+/**
+ * @brief Defines the handle to an animation that is evaluated by the render service.
+ *
+ * Unlike {@link ArkUI_NativeAnimateAPI_1}.animateTo, the frames of such an animation are computed in the render
+ * service, so a busy UI thread does not cause the animation to drop frames.
+ *
+ * @since 26.1.0
+ */
+typedef struct ArkUI_RenderServiceAnimation* ArkUI_RenderServiceAnimationHandle;
+
+/**
+ * @brief Enumerates the render node properties that can be animated by the render service.
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** Opacity. One end value is required, in the range [0.0, 1.0]. */
+    ARKUI_RENDER_SERVICE_ANIMATION_PROPERTY_OPACITY = 0,
+    /** Translation. Two end values are required: x and y, in px. */
+    ARKUI_RENDER_SERVICE_ANIMATION_PROPERTY_TRANSLATION,
+    /** Scale. Two end values are required: scale factors on the x-axis and y-axis. */
+    ARKUI_RENDER_SERVICE_ANIMATION_PROPERTY_SCALE,
+    /** Rotation. Three end values are required: angles around the x-axis, y-axis and z-axis, in degrees. */
+    ARKUI_RENDER_SERVICE_ANIMATION_PROPERTY_ROTATION,
+} ArkUI_RenderServiceAnimationProperty;
+
+/**
+ * @brief Defines the callback invoked when an animation evaluated by the render service ends.
+ *
+ * The callback is invoked on the UI thread. When the animation is finished, the property has been updated to
+ * the end value on the UI side before the callback is invoked.
+ *
+ * @param animation Animation that has ended.
+ * @param isCancelled Whether the animation ended because {@link OH_ArkUI_RenderServiceAnimation_Cancel} was called.
+ * @param userData Custom data passed during registration.
+ * @since 26.1.0
+ */
+typedef void (*ArkUI_RenderServiceAnimation_OnFinishCallback)(
+    ArkUI_RenderServiceAnimationHandle animation, bool isCancelled, void* userData);
+
+/**
+ * @brief Creates an animation that is evaluated by the render service for a property of a render node.
+ *
+ * @note Only curves that can be evaluated without calling back into the application are supported. Custom curves
+ *     created by {@link OH_ArkUI_Curve_CreateCustomCurve} are rejected.
+ * @param node Target render node.
+ * @param property Property to animate.
+ * @param endValues Array of end values. The number of values depends on <b>property</b>.
+ * @param size Number of elements in <b>endValues</b>.
+ * @param option Animation configuration, including the duration, curve, delay, iterations and play mode.
+ * @param animation Pointer to the created animation, which is used as an output parameter.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_CreateForRenderNode(ArkUI_RenderNodeHandle node,
+    ArkUI_RenderServiceAnimationProperty property, const float* endValues, int32_t size,
+    ArkUI_AnimateOption* option, ArkUI_RenderServiceAnimationHandle* animation);
+
+/**
+ * @brief Creates an animation that is evaluated by the render service for a float animatable property.
+ *
+ * @note The same curve restrictions as {@link OH_ArkUI_RenderServiceAnimation_CreateForRenderNode} apply.
+ * @param property Float animatable property.
+ * @param endValue End value of the property.
+ * @param option Animation configuration.
+ * @param animation Pointer to the created animation, which is used as an output parameter.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_CreateForFloatProperty(
+    ArkUI_FloatAnimatablePropertyHandle property, float endValue, ArkUI_AnimateOption* option,
+    ArkUI_RenderServiceAnimationHandle* animation);
+
+/**
+ * @brief Creates an animation that is evaluated by the render service for a two-dimensional vector animatable
+ * property.
+ *
+ * @note The same curve restrictions as {@link OH_ArkUI_RenderServiceAnimation_CreateForRenderNode} apply.
+ * @param property Two-dimensional vector animatable property.
+ * @param endX End value of the x component.
+ * @param endY End value of the y component.
+ * @param option Animation configuration.
+ * @param animation Pointer to the created animation, which is used as an output parameter.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_CreateForVector2Property(
+    ArkUI_Vector2AnimatablePropertyHandle property, float endX, float endY, ArkUI_AnimateOption* option,
+    ArkUI_RenderServiceAnimationHandle* animation);
+
+/**
+ * @brief Starts an animation evaluated by the render service. The animation starts from the current value of the
+ * property.
+ *
+ * @param animation Target animation.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_Start(ArkUI_RenderServiceAnimationHandle animation);
+
+/**
+ * @brief Cancels a running animation evaluated by the render service. The property keeps the value of the last
+ * presented frame.
+ *
+ * @param animation Target animation.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_Cancel(ArkUI_RenderServiceAnimationHandle animation);
+
+/**
+ * @brief Registers the callback invoked when an animation evaluated by the render service ends.
+ *
+ * @param animation Target animation.
+ * @param userData Custom data passed to the callback.
+ * @param callback Callback to register. Passing <b>NULL</b> unregisters the callback.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_RegisterOnFinishCallback(
+    ArkUI_RenderServiceAnimationHandle animation, void* userData,
+    ArkUI_RenderServiceAnimation_OnFinishCallback callback);
+
+/**
+ * @brief Obtains the number of frames the render service dropped while evaluating an animation.
+ *
+ * @param animation Target animation.
+ * @param count Pointer to the number of dropped frames, which is used as an output parameter.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_GetDroppedFrameCount(
+    ArkUI_RenderServiceAnimationHandle animation, uint32_t* count);
+
+/**
+ * @brief Disposes of an animation evaluated by the render service.
+ *
+ * A running animation is cancelled first. The registered finish callback is invoked synchronously before this API
+ * returns, with <b>isCancelled</b> set to true, so that the custom data passed during registration can be released
+ * there. The callback is not invoked if the animation has already ended.
+ *
+ * @param animation Target animation.
+ * @since 26.1.0
+ */
+void OH_ArkUI_RenderServiceAnimation_Dispose(ArkUI_RenderServiceAnimationHandle animation);
 #ifdef __cplusplus
 };
 #endif
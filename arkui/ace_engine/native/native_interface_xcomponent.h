@@ -1343,6 +1343,59 @@ void OH_ArkUI_XComponentSurfaceConfig_Dispose(ArkUI_XComponentSurfaceConfig* con
  */
 void OH_ArkUI_XComponentSurfaceConfig_SetIsOpaque(ArkUI_XComponentSurfaceConfig* config, bool isOpaque);
 
+/**
+ * @brief Enumerates the modes in which the surface held by XComponent presents buffers.
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** Buffers are presented in the order they are flushed. A producer that is ahead of the display blocks
+     *  when the queue is full. */
+    ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_FIFO = 0,
+    /** Only the latest flushed buffer is presented. Older queued buffers are released without being displayed,
+     *  so the producer never blocks on a full queue. */
+    ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_MAILBOX = 1,
+} ArkUI_XComponentSurfacePresentMode;
+
+/**
+ * @brief Set the buffer queue size of the surface held by XComponent.
+ *
+ * The setting takes effect when the surface is created, so set the config before the surface is created.
+ *
+ * @param config A pointer to the object of the XComponent's surface config.
+ * @param queueSize Indicates the number of buffers in the queue. The value range is [1, 5].
+ *     The default value is 3. If the value is out of range, the default value is used.
+ *     In {@link ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_MAILBOX} mode, a queue size of 1 is raised to 2.
+ * @since 26.1.0
+ */
+void OH_ArkUI_XComponentSurfaceConfig_SetBufferQueueSize(ArkUI_XComponentSurfaceConfig* config, uint32_t queueSize);
+
+/**
+ * @brief Set whether all buffers in the queue of the surface held by XComponent are allocated when the surface
+ * is created, so that the first frames after the surface is shown do not wait for buffer allocation.
+ *
+ * @param config A pointer to the object of the XComponent's surface config.
+ * @param preallocate Indicates whether to pre-allocate buffers. True means buffers are allocated with the size and
+ *     format of the surface when it is created, false means buffers are allocated on first request.
+ *     The default value is false. If the geometry, format or usage of the buffers is later changed through
+ *     <b>OH_NativeWindow_NativeWindowHandleOpt</b>, the pre-allocated buffers are discarded and buffers are
+ *     allocated again with the new settings on request.
+ * @since 26.1.0
+ */
+void OH_ArkUI_XComponentSurfaceConfig_SetPreallocateBuffers(ArkUI_XComponentSurfaceConfig* config, bool preallocate);
+
+/**
+ * @brief Set the present mode of the surface held by XComponent.
+ *
+ * @param config A pointer to the object of the XComponent's surface config.
+ * @param mode Indicates the present mode. The default value is {@link ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_FIFO}.
+ *     {@link ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_MAILBOX} requires at least 2 buffers; if the buffer queue size
+ *     is set to 1, 2 buffers are used.
+ * @since 26.1.0
+ */
+void OH_ArkUI_XComponentSurfaceConfig_SetPresentMode(
+    ArkUI_XComponentSurfaceConfig* config, ArkUI_XComponentSurfacePresentMode mode);
+
 /**
  * @brief Set surface config for this <b>OH_ArkUI_SurfaceHolder</b> instance.
  *
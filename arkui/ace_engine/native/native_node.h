@@ -17702,6 +17702,425 @@ ArkUI_ErrorCode OH_ArkUI_NativeModule_SetChildMountPolicy(ArkUI_NodeHandle node,
  */
 ArkUI_ErrorCode OH_ArkUI_NativeModule_GetChildMountPolicy(ArkUI_NodeHandle node, OH_ArkUI_NodeMountPolicy* policy);
 
+/**
+ * @brief Defines an attribute entry used to set multiple attributes of a node in one call.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Attribute type. */
+    ArkUI_NodeAttributeType attribute;
+    /** Pointer to the attribute value. */
+    const ArkUI_AttributeItem* item;
+} ArkUI_NodeAttributeEntry;
+
+/**
+ * @brief Sets multiple attributes of a node in one call.
+ * All entries are validated before any of them is applied. If an entry is invalid, no attribute is set.
+ * The node is marked dirty once and measured and laid out once for the whole batch, instead of once per attribute
+ * as with {@link setAttribute}.
+ *
+ * @param node Target node.
+ * @param entries Pointer to the array of attribute entries. If an attribute appears more than once, the last entry
+ *     takes effect.
+ * @param count Number of entries in the array.
+ * @param failedIndex Index of the first invalid entry when the operation fails. This parameter can be null.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_ATTRIBUTE_OR_EVENT_NOT_SUPPORTED} An attribute is not supported by the node.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_SetAttributes(ArkUI_NodeHandle node, const ArkUI_NodeAttributeEntry* entries,
+    uint32_t count, uint32_t* failedIndex);
+
+/**
+ * @brief Creates a node style.
+ *
+ * @return Returns the pointer to the node style created. Returns null if memory allocation fails.
+ * @since 26.1.0
+ */
+ArkUI_NodeStyle* OH_ArkUI_NodeStyle_Create(void);
+
+/**
+ * @brief Disposes of a node style. Nodes to which the style has been applied are not affected.
+ *
+ * @param style Pointer to the node style.
+ * @since 26.1.0
+ */
+void OH_ArkUI_NodeStyle_Dispose(ArkUI_NodeStyle* style);
+
+/**
+ * @brief Adds an attribute to a node style. The attribute value is copied into the style and validated once, so it
+ * is not validated again each time the style is applied.
+ * Changes made to a style do not affect nodes to which the style has already been applied.
+ *
+ * @param style Pointer to the node style.
+ * @param attribute Attribute type.
+ * @param item Pointer to the attribute value.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NodeStyle_SetAttribute(ArkUI_NodeStyle* style, ArkUI_NodeAttributeType attribute,
+    const ArkUI_AttributeItem* item);
+
+/**
+ * @brief Applies a node style to a node. All attributes of the style are set on the node in one call, with a single
+ * dirty mark and a single measurement and layout. Attributes not contained in the style keep their values.
+ *
+ * @param node Target node.
+ * @param style Pointer to the node style.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_ATTRIBUTE_OR_EVENT_NOT_SUPPORTED} An attribute of the style is not supported
+ *     by the node.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_ApplyStyle(ArkUI_NodeHandle node, const ArkUI_NodeStyle* style);
+
+/**
+ * @brief Defines the statistics of the recycle pool of a component adapter for one reuse type.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Number of requests for a recycled node that returned a node from the pool. */
+    uint64_t hitCount;
+    /** Number of requests for a recycled node that found the pool empty. */
+    uint64_t missCount;
+    /** Number of nodes currently held in the pool. */
+    uint32_t pooledCount;
+} ArkUI_NodeAdapterRecycleStats;
+
+/**
+ * @brief Defines the callback used to create a node for the recycle pool of a component adapter in advance.
+ *
+ * @param handle Component adapter.
+ * @param reuseType Reuse type of the node to create.
+ * @param userData Custom data passed in when the callback is registered.
+ * @return Returns the node created. Returning null stops the pre-creation.
+ * @since 26.1.0
+ */
+typedef ArkUI_NodeHandle (*ArkUI_NodeAdapter_CreateRecycledNodeCallback)(ArkUI_NodeAdapterHandle handle,
+    int32_t reuseType, void* userData);
+
+/**
+ * @brief Sets the maximum number of nodes of a reuse type kept in the recycle pool of a component adapter.
+ * When a node added through {@link OH_ArkUI_NodeAdapterEvent_SetItemWithReuseType} is removed from the adapter and
+ * the pool of its reuse type is not full, the node is detached but kept alive in the pool, and no
+ * <b>NODE_ADAPTER_EVENT_ON_REMOVE_NODE_FROM_ADAPTER</b> event is sent for it. By default, the capacity is 0 and no node
+ * is pooled.
+ * If the new capacity is less than the number of pooled nodes, the extra nodes are removed from the pool and a
+ * <b>NODE_ADAPTER_EVENT_ON_REMOVE_NODE_FROM_ADAPTER</b> event is sent for each of them.
+ * When the adapter is disposed of through <b>OH_ArkUI_NodeAdapter_Dispose</b>, all pooled nodes are removed from the
+ * pool and a <b>NODE_ADAPTER_EVENT_ON_REMOVE_NODE_FROM_ADAPTER</b> event is sent for each of them before the adapter
+ * is released, so pooled nodes can always be disposed of by the application.
+ *
+ * @param handle Component adapter.
+ * @param reuseType Reuse type defined by the application.
+ * @param capacity Maximum number of pooled nodes of the reuse type.
+ * @return Returns the error code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter error occurs.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapter_SetRecyclePoolCapacity(ArkUI_NodeAdapterHandle handle, int32_t reuseType,
+    uint32_t capacity);
+
+/**
+ * @brief Creates nodes of a reuse type for the recycle pool of a component adapter during idle frames.
+ * The callback is called on the UI thread when a frame has time left, until the pool holds <b>count</b> nodes of the
+ * reuse type or the pool is full.
+ *
+ * @param handle Component adapter.
+ * @param reuseType Reuse type of the nodes to create.
+ * @param count Number of pooled nodes to reach.
+ * @param callback Callback used to create a node.
+ * @param userData Custom data passed to the callback.
+ * @return Returns the error code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter error occurs.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapter_PrecreateRecycledNodes(ArkUI_NodeAdapterHandle handle, int32_t reuseType,
+    uint32_t count, ArkUI_NodeAdapter_CreateRecycledNodeCallback callback, void* userData);
+
+/**
+ * @brief Removes all nodes from the recycle pool of a component adapter. A
+ * <b>NODE_ADAPTER_EVENT_ON_REMOVE_NODE_FROM_ADAPTER</b> event is sent for each of them so that they can be disposed of.
+ * The same happens for the pooled nodes when the adapter is disposed of.
+ *
+ * @param handle Component adapter.
+ * @return Returns the error code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter error occurs.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapter_ClearRecyclePool(ArkUI_NodeAdapterHandle handle);
+
+/**
+ * @brief Obtains the statistics of the recycle pool of a component adapter for a reuse type.
+ *
+ * @param handle Component adapter.
+ * @param reuseType Reuse type.
+ * @param stats Pointer to the statistics, which is used as an output parameter.
+ * @return Returns the error code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter error occurs.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapter_GetRecyclePoolStats(ArkUI_NodeAdapterHandle handle, int32_t reuseType,
+    ArkUI_NodeAdapterRecycleStats* stats);
+
+/**
+ * @brief Takes a node of a reuse type out of the recycle pool of the component adapter of an event.
+ * Call this API when handling the <b>NODE_ADAPTER_EVENT_ON_ADD_NODE_TO_ADAPTER</b> event, update the attributes of
+ * the node returned for the new index, and pass it to {@link OH_ArkUI_NodeAdapterEvent_SetItemWithReuseType}.
+ *
+ * @param event Target adapter event.
+ * @param reuseType Reuse type of the node.
+ * @param node Pointer to the node taken out of the pool, which is used as an output parameter. It is set to null if
+ *     the pool of the reuse type is empty.
+ * @return Returns the error code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter error occurs.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapterEvent_DequeueRecycledNode(ArkUI_NodeAdapterEvent* event, int32_t reuseType,
+    ArkUI_NodeHandle* node);
+
+/**
+ * @brief Sets the component to be added to the specified adapter and the reuse type used to recycle it when it is
+ * removed from the adapter.
+ *
+ * @param event Target adapter event.
+ * @param node Component to be added.
+ * @param reuseType Reuse type defined by the application.
+ * @return Returns the error code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter error occurs.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapterEvent_SetItemWithReuseType(ArkUI_NodeAdapterEvent* event, ArkUI_NodeHandle node,
+    int32_t reuseType);
+
+/**
+ * @brief Creates a detached builder for a UI instance. This API can be called on any thread.
+ *
+ * @param context Pointer to the UI instance object.
+ * @param builder Pointer to the detached builder created, which is used as an output parameter.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_UI_CONTEXT_INVALID} The UI instance is invalid.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_Create(ArkUI_ContextHandle context, ArkUI_DetachedBuilder** builder);
+
+/**
+ * @brief Disposes of a detached builder. This API can be called on any thread.
+ * All nodes created in the builder that have not been committed are disposed of together with the builder, and their
+ * handles become invalid. Committed nodes are not affected.
+ * If the builder is bound to the current thread, it is unbound first as if {@link OH_ArkUI_DetachedBuilder_Leave}
+ * were called. If the builder is bound to another thread, the call is ignored and the builder remains valid.
+ *
+ * @param builder Pointer to the detached builder.
+ * @since 26.1.0
+ */
+void OH_ArkUI_DetachedBuilder_Dispose(ArkUI_DetachedBuilder* builder);
+
+/**
+ * @brief Binds a detached builder to the current thread.
+ * Until {@link OH_ArkUI_DetachedBuilder_Leave} is called, nodes created on the current thread belong to the builder,
+ * and the APIs of {@link ArkUI_NativeNodeAPI_1} that create nodes, set and reset attributes, and add and remove child
+ * nodes can be called on the current thread for these nodes. Calling them for nodes that are not created in the
+ * builder returns {@link ARKUI_ERROR_CODE_NODE_ON_INVALID_THREAD}.
+ * A builder can be bound to only one thread at a time.
+ *
+ * @param builder Pointer to the detached builder.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception, or the builder has been bound to
+ *     another thread or committed.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_Enter(ArkUI_DetachedBuilder* builder);
+
+/**
+ * @brief Unbinds a detached builder from the current thread. The builder can then be bound to another thread or
+ * committed.
+ *
+ * @param builder Pointer to the detached builder.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception, or the builder is not bound to the
+ *     current thread.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_Leave(ArkUI_DetachedBuilder* builder);
+
+/**
+ * @brief Sets the root node of the subtree built in a detached builder. The node must be created in the builder.
+ *
+ * @param builder Pointer to the detached builder.
+ * @param root Root node of the subtree.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception, or the node is not created in the
+ *     builder.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_SetRootNode(ArkUI_DetachedBuilder* builder, ArkUI_NodeHandle root);
+
+/**
+ * @brief Measures and lays out the subtree of a detached builder with the specified constraint on the thread to
+ * which the builder is bound.
+ *
+ * @param builder Pointer to the detached builder.
+ * @param constraint Layout constraint expected from the parent node the subtree will be committed to.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception, or the root node is not set.
+ *     </li><li>{@link ARKUI_ERROR_CODE_NODE_ON_INVALID_THREAD} The builder is not bound to the current thread.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_MeasureAndLayout(ArkUI_DetachedBuilder* builder,
+    const ArkUI_LayoutConstraint* constraint);
+
+/**
+ * @brief Attaches the subtree of a detached builder to a parent node in one operation. This API must be called on
+ * the UI thread after the builder has left its thread. The cost does not depend on the size of the subtree. The
+ * layout result is reused if the parent node gives the subtree the constraint passed to
+ * {@link OH_ArkUI_DetachedBuilder_MeasureAndLayout}; otherwise the subtree is laid out again in the next frame.
+ * After the commit, the nodes of the subtree are ordinary nodes that can be operated only on the UI thread.
+ *
+ * @param builder Pointer to the detached builder.
+ * @param parent Parent node.
+ * @param index Position of the subtree among the child nodes of the parent node. The value <b>-1</b> means to append
+ *     the subtree to the end.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception, the root node is not set, or the
+ *     builder is still bound to a thread or has been committed.
+ *     </li><li>{@link ARKUI_ERROR_CODE_NODE_ON_INVALID_THREAD} The API is not called on the UI thread.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_Commit(ArkUI_DetachedBuilder* builder, ArkUI_NodeHandle parent,
+    int32_t index);
+
+/**
+ * @brief Defines the layout statistics of a frame.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Number of nodes measured in the frame. */
+    uint32_t measuredNodeCount;
+    /** Number of nodes laid out in the frame. */
+    uint32_t laidOutNodeCount;
+    /** Number of measurements skipped because the cached result of the node could be reused. */
+    uint32_t measureCacheHitCount;
+    /** Number of subtree relayouts triggered by <b>markDirty</b> with {@link NODE_NEED_MEASURE}. */
+    uint32_t relayoutByMeasureFlagCount;
+    /** Number of subtree relayouts triggered by <b>markDirty</b> with {@link NODE_NEED_LAYOUT}. */
+    uint32_t relayoutByLayoutFlagCount;
+    /** Number of subtree relayouts triggered by attribute changes. */
+    uint32_t relayoutByAttributeCount;
+    /** Number of subtree relayouts triggered by adding or removing child nodes. */
+    uint32_t relayoutByChildChangeCount;
+    /** Number of subtree relayouts triggered by a change of the layout constraint from the parent node. */
+    uint32_t relayoutByConstraintCount;
+} ArkUI_LayoutFrameStats;
+
+/**
+ * @brief Registers a callback that reports the layout statistics of each frame of a UI instance.
+ * Statistics are collected only while a callback is registered.
+ *
+ * @param uiContext Pointer to the UI instance object.
+ * @param userData Custom data passed to the callback.
+ * @param callback Callback executed on the UI thread after the layout of each frame. The statistics are valid only
+ *     during the callback. The value null means to unregister the callback and stop collecting statistics.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_UI_CONTEXT_INVALID} The UI instance is invalid.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_RegisterLayoutStatsCallback(ArkUI_ContextHandle uiContext, void* userData,
+    void (*callback)(const ArkUI_LayoutFrameStats* stats, uint32_t frameCount, void* userData));
+
+/**
+ * @brief Sets whether to pin the measurement result of a node.
+ * While the result is pinned, the node is not measured again as long as the layout constraint from its parent node
+ * is unchanged. When a descendant requests measurement, for example because its text content has changed, the
+ * request is not propagated to the ancestors of the node; instead, the subtree of the node is measured and laid out
+ * again under the cached layout constraint of the node, and the size of the node is kept. Calling <b>markDirty</b>
+ * on the node itself with {@link NODE_NEED_MEASURE} still measures it again.
+ * Use this for nodes whose size does not depend on their content, such as fixed-size list items.
+ *
+ * @param node Target node.
+ * @param pinned Whether to pin the measurement result. The value true means to pin the result, and false means the
+ *     opposite. The default value is false.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_SetMeasureResultPinned(ArkUI_NodeHandle node, bool pinned);
+
+/**
+ * @brief Registers a receiver that gets the events of a node coalesced per frame.
+ * For the event types for which coalescing is enabled through {@link OH_ArkUI_NativeModule_SetEventCoalescingEnabled},
+ * the events that a node receives in a frame are delivered to this receiver as one array, in the order in which
+ * they occurred, instead of being delivered one by one to the receivers registered through
+ * <b>registerNodeEventReceiver</b> or <b>addNodeEventReceiver</b>. Consecutive touch move events of the same pointers
+ * are merged into one event: the receiver gets the last touch move event of the frame, and the touch points of the
+ * earlier ones are kept as its history, which can be obtained through <b>OH_ArkUI_PointerEvent_GetHistory*</b>.
+ * Coalesced events are delivered after the synchronous dispatch of the frame has completed. Therefore, propagation
+ * control such as <b>OH_ArkUI_PointerEvent_SetStopPropagation</b> and the consumed state of the events are ignored.
+ *
+ * @param node Target node.
+ * @param userData Custom data passed to the receiver.
+ * @param receiver Receiver executed on the UI thread once per frame in which the node has coalesced events. The events
+ *     are valid only during the callback. The value null means to unregister the receiver.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_RegisterCoalescedEventReceiver(ArkUI_NodeHandle node, void* userData,
+    void (*receiver)(ArkUI_NodeEvent** events, uint32_t count, void* userData));
+
+/**
+ * @brief Sets whether to coalesce an event type of a node per frame. Coalesced events are delivered to the receiver
+ * registered through {@link OH_ArkUI_NativeModule_RegisterCoalescedEventReceiver}. Coalescing is intended for
+ * high-frequency events such as {@link NODE_TOUCH_EVENT} and {@link NODE_SCROLL_EVENT_ON_SCROLL}. Events whose return
+ * value is read by the framework, such as those set through <b>OH_ArkUI_NodeEvent_SetReturnNumberValue</b>, cannot
+ * be coalesced. Because propagation control is ignored for coalesced events, enable coalescing for touch events
+ * only on nodes that do not need to stop their propagation.
+ *
+ * @param node Target node.
+ * @param eventType Event type, which must have been registered on the node through <b>registerNodeEvent</b>.
+ * @param enabled Whether to coalesce the event type. The value true means to coalesce the event type, and false means
+ *     the opposite. The default value is false.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_NODE_UNSUPPORTED_EVENT_TYPE} The event type cannot be coalesced.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_SetEventCoalescingEnabled(ArkUI_NodeHandle node, ArkUI_NodeEventType eventType,
+    bool enabled);
+
 #ifdef __cplusplus
 };
 #endif
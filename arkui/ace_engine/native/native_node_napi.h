@@ -430,6 +430,67 @@ int32_t OH_ArkUI_PostIdleCallback(ArkUI_ContextHandle uiContext, void* userData,
 ArkUI_ErrorCode OH_ArkUI_EnableEventPassthrough(ArkUI_ContextHandle uiContext, bool enabled,
     ArkUI_RawInputEventType type);
 
+/**
+ * @brief Register a callback to be executed in the idle time of the next frame, with a deadline object that reports
+ *        the frame budget left while the callback runs. Unlike {@link OH_ArkUI_PostIdleCallback}, which passes the
+ *        time left when the callback starts, the deadline can be queried repeatedly, so that work such as creating
+ *        nodes, measuring text or decoding images can be split into small steps and stopped before the budget runs
+ *        out. If there is no next frame, will request one automatically. Cannot be called on the non-UI thread.
+ *
+ * @param uiContext ArkUI_ContextHandle.
+ * @param userData Indicates the custom data to be saved.
+ * @param callback Custom callback function. The deadline object is valid only during the callback.
+ * @param nanoTimeout Maximum time to wait for idle time, in nanoseconds. When it elapses, the callback is executed
+ *        even if the frame has no idle time, and {@link OH_ArkUI_IdleDeadline_IsTimeout} returns true.
+ *        The value 0 means to wait without limit.
+ * @return Returns the result code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if the CAPI init error.
+ *         Returns {@link ARKUI_ERROR_CODE_UI_CONTEXT_INVALID} if the uiContext is invalid.
+ *         Returns {@link ARKUI_ERROR_CODE_CALLBACK_INVALID} if the callback function is invalid.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_PostIdleCallbackWithDeadline(ArkUI_ContextHandle uiContext, void* userData,
+    void (*callback)(ArkUI_IdleDeadline* deadline, void* userData), uint64_t nanoTimeout);
+
+/**
+ * @brief Obtains the time left in the current frame budget. The value is computed each time this API is called.
+ *
+ * @param deadline Pointer to the deadline object.
+ * @param nanoTimeLeft Time left before the frame budget runs out, in nanoseconds. The value is 0 if the budget has
+ *        run out. It is used as an output parameter.
+ * @return Returns the result code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if deadline or nanoTimeLeft is null.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_IdleDeadline_GetTimeLeft(const ArkUI_IdleDeadline* deadline, uint64_t* nanoTimeLeft);
+
+/**
+ * @brief Obtains the frame count of the frame in which the idle callback is executed.
+ *
+ * @param deadline Pointer to the deadline object.
+ * @param frameCount Frame count, which is used as an output parameter.
+ * @return Returns the result code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if deadline or frameCount is null.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_IdleDeadline_GetFrameCount(const ArkUI_IdleDeadline* deadline, uint32_t* frameCount);
+
+/**
+ * @brief Checks whether the idle callback is executed because the timeout passed to
+ *        {@link OH_ArkUI_PostIdleCallbackWithDeadline} elapsed rather than because the frame has idle time.
+ *
+ * @param deadline Pointer to the deadline object.
+ * @param isTimeout Whether the callback is executed because of the timeout, which is used as an output parameter.
+ * @return Returns the result code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if deadline or isTimeout is null.
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_IdleDeadline_IsTimeout(const ArkUI_IdleDeadline* deadline, bool* isTimeout);
+
 #ifdef __cplusplus
 };
 #endif
@@ -2285,6 +2285,68 @@ ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_GetRenderNodeChildrenCount(ArkUI_NodeHa
  */
 ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_GetRenderNodeAt(
     ArkUI_NodeHandle node, int32_t position, ArkUI_RenderNodeHandle* child);
+
+/**
+ * @brief Enumerates the cache hints of a render node.
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** No caching. The subtree of the render node is drawn every frame. This is the default value. */
+    ARKUI_RENDER_NODE_CACHE_HINT_NONE = 0,
+    /**
+     * The drawing commands of the subtree are recorded once and replayed until the content of the subtree changes.
+     */
+    ARKUI_RENDER_NODE_CACHE_HINT_DISPLAY_LIST = 1,
+    /**
+     * The subtree is rasterized to an offscreen layer, which is reused while only the transform and opacity of the
+     * render node change. The layer is rasterized again when the content or size of the subtree changes.
+     */
+    ARKUI_RENDER_NODE_CACHE_HINT_RASTER = 2,
+} ArkUI_RenderNodeCacheHint;
+
+/**
+ * @brief Sets the cache hint of a render node. Use it for static subtrees, such as complex backgrounds, that would
+ * otherwise be redrawn every frame during animations. The hint may be ignored, for example when the offscreen layer
+ * would exceed the memory limit of the system.
+ *
+ * @param node Target render node.
+ * @param hint Cache hint.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.
+ *     </li><li>{@link ARKUI_ERROR_CODE_RENDER_IS_FROM_FRAME_NODE} The target node is obtained from a FrameNode.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_SetCacheHint(ArkUI_RenderNodeHandle node, ArkUI_RenderNodeCacheHint hint);
+
+/**
+ * @brief Obtains the cache hint of a render node.
+ *
+ * @param node Target render node.
+ * @param hint Pointer to the cache hint, which is used as an output parameter.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_GetCacheHint(ArkUI_RenderNodeHandle node, ArkUI_RenderNodeCacheHint* hint);
+
+/**
+ * @brief Obtains the number of times the cache of a render node has been invalidated since its cache hint was set.
+ * A count that grows every frame means that the subtree is not static and caching it only adds cost.
+ *
+ * @param node Target render node.
+ * @param count Pointer to the invalidation count, which is used as an output parameter.
+ * @return Error code.
+ *     <ul><li>{@link ARKUI_ERROR_CODE_NO_ERROR} Success.
+ *     </li><li>{@link ARKUI_ERROR_CODE_PARAM_INVALID} Function parameter exception.
+ *     </li><li>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} if CAPI init error.</li></ul>
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_GetCacheInvalidationCount(ArkUI_RenderNodeHandle node, uint32_t* count);
 #ifdef __cplusplus
 };
 #endif
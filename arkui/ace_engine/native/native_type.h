@@ -149,6 +149,28 @@ typedef struct ArkUI_CrossLanguageOption ArkUI_CrossLanguageOption;
  */
 typedef struct ArkUI_SelectedDragPreviewStyle ArkUI_SelectedDragPreviewStyle;
 
+/**
+ * @brief Defines a node style, which is a prebuilt set of attributes that can be applied to nodes in one call.
+ *
+ * @since 26.1.0
+ */
+typedef struct ArkUI_NodeStyle ArkUI_NodeStyle;
+
+/**
+ * @brief Defines a detached builder, in which a component subtree can be built and laid out on a non-UI thread and
+ * then attached to the component tree in one operation.
+ *
+ * @since 26.1.0
+ */
+typedef struct ArkUI_DetachedBuilder ArkUI_DetachedBuilder;
+
+/**
+ * @brief Defines the deadline of an idle callback, which tracks the time left in the current frame.
+ *
+ * @since 26.1.0
+ */
+typedef struct ArkUI_IdleDeadline ArkUI_IdleDeadline;
+
 /**
  * @brief Enumerates the text copy and paste modes.
  *
@@ -3570,6 +3570,97 @@ ArkUI_ErrorCode OH_ArkUI_ParagraphStyle_SetTailIndents(
 ArkUI_ErrorCode OH_ArkUI_ParagraphStyle_GetTailIndents(const OH_ArkUI_ParagraphStyle* paragraphStyle,
     float** tailIndents, uint32_t tailIndentsSize, uint32_t* writeLength);
 
+/**
+ * @brief Defines a styled string whose text layout is precomputed and updated incrementally after edits.
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_ArkUI_PrecomputedStyledString OH_ArkUI_PrecomputedStyledString;
+
+/**
+ * @brief Creates a precomputed styled string and lays out the content of a styled string.
+ *
+ * After creation, edits made to the descriptor through APIs such as
+ * {@link OH_ArkUI_StyledString_Descriptor_InsertString} and {@link OH_ArkUI_StyledString_Descriptor_RemoveString}
+ * are recorded, and {@link OH_ArkUI_PrecomputedStyledString_Relayout} reshapes only the affected runs and lines.
+ *
+ * @note All input pointer parameters must be allocated, managed, and released by the caller.
+ *     The descriptor must remain valid until the precomputed styled string is destroyed.
+ * @param descriptor Pointer to the {@link ArkUI_StyledString_Descriptor} object.
+ * @param maxWidth Maximum width of a line, in px.
+ * @return Returns the pointer to the precomputed styled string; returns <b>NULL</b> if a parameter error occurs.
+ * @since 26.1.0
+ */
+OH_ArkUI_PrecomputedStyledString* OH_ArkUI_PrecomputedStyledString_Create(
+    ArkUI_StyledString_Descriptor* descriptor, float maxWidth);
+
+/**
+ * @brief Destroys a precomputed styled string. The bound descriptor is not destroyed.
+ *
+ * @param precomputed Pointer to the <b>OH_ArkUI_PrecomputedStyledString</b> object.
+ * @since 26.1.0
+ */
+void OH_ArkUI_PrecomputedStyledString_Destroy(OH_ArkUI_PrecomputedStyledString* precomputed);
+
+/**
+ * @brief Updates the layout of a precomputed styled string after the bound descriptor has been edited.
+ *
+ * Only the runs that overlap an edited range are reshaped. Line breaking restarts at the first affected line and
+ * stops as soon as a line boundary matches the previous layout; the remaining lines are reused.
+ * If the descriptor has not been edited since the last layout, this API does nothing.
+ *
+ * @param precomputed Pointer to the <b>OH_ArkUI_PrecomputedStyledString</b> object.
+ * @return Returns the result code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter exception occurs.
+ *         Returns {@link ARKUI_ERROR_CODE_INVALID_STYLED_STRING} if the styled string is invalid.
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_PrecomputedStyledString_Relayout(OH_ArkUI_PrecomputedStyledString* precomputed);
+
+/**
+ * @brief Sets the maximum line width of a precomputed styled string.
+ *
+ * Shaped runs are kept, and only line breaking is performed again.
+ *
+ * @param precomputed Pointer to the <b>OH_ArkUI_PrecomputedStyledString</b> object.
+ * @param maxWidth Maximum width of a line, in px.
+ * @return Returns the result code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter exception occurs.
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_PrecomputedStyledString_SetMaxWidth(
+    OH_ArkUI_PrecomputedStyledString* precomputed, float maxWidth);
+
+/**
+ * @brief Obtains the number of lines reused and reshaped by the last layout of a precomputed styled string.
+ *
+ * @param precomputed Pointer to the <b>OH_ArkUI_PrecomputedStyledString</b> object.
+ * @param reusedLineCount Number of lines taken from the previous layout without being reshaped.
+ * @param reshapedLineCount Number of lines that were reshaped or broken again.
+ * @return Returns the result code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter exception occurs.
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_PrecomputedStyledString_GetRelayoutLineCount(
+    const OH_ArkUI_PrecomputedStyledString* precomputed, uint32_t* reusedLineCount, uint32_t* reshapedLineCount);
+
+/**
+ * @brief Sets a precomputed styled string to the text. The text uses the precomputed layout directly when its
+ * content width equals the maximum line width of the precomputed styled string.
+ *
+ * @param controller the controller of the text.
+ * @param precomputed Pointer to the <b>OH_ArkUI_PrecomputedStyledString</b> object.
+ * @return Returns the result code.
+ *         Returns {@link ARKUI_ERROR_CODE_NO_ERROR} if the operation is successful.
+ *         Returns {@link ARKUI_ERROR_CODE_PARAM_INVALID} if a parameter exception occurs.
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_TextController_SetPrecomputedStyledString(
+    OH_ArkUI_TextController* controller, OH_ArkUI_PrecomputedStyledString* precomputed);
+
 #ifdef __cplusplus
 };
 #endif
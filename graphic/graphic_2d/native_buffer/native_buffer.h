@@ -427,6 +427,96 @@ int32_t OH_NativeBuffer_IsSupported(OH_NativeBuffer_Config config, bool* isSuppo
  * @version 1.0
  */
 int32_t OH_NativeBuffer_MapAndGetConfig(OH_NativeBuffer* buffer, void** virAddr, OH_NativeBuffer_Config* config);
+
+/**
+ * @brief Defines a native buffer pool, which suballocates many <b>OH_NativeBuffer</b> instances from one shared
+ * memory allocation.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct OH_NativeBuffer_Pool OH_NativeBuffer_Pool;
+
+/**
+ * @brief Creates a <b>OH_NativeBuffer_Pool</b> backed by one shared memory allocation.\n
+ * Allocating small buffers from a pool avoids the allocation and mapping cost and the file descriptor of each
+ * separate allocation.\n
+ * This interface needs to be used in conjunction with <b>OH_NativeBuffer_DestroyPool</b>,
+ * otherwise memory leaks will occur.\n
+ * The pool synchronizes internally, so buffers can be allocated from it and unreferenced on any thread.\n
+ * This interface is a thread-safe type interface.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param size Indicates the size of the shared memory allocation, in bytes.
+ * @param usage Indicates the combination of buffer usage of the allocation. The buffers allocated from the pool
+ *     can use only these usages.
+ * @param pool Indicates the pointer to the <b>OH_NativeBuffer_Pool</b> pointer created.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ * {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - pool is NULL or size is 0.
+ * {@link NATIVE_ERROR_UNSUPPORTED} 50102000 - usage is not supported.
+ * {@link NATIVE_ERROR_MEM_OPERATION_ERROR} 30001000 - allocate memory failed.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_CreatePool(uint64_t size, int32_t usage, OH_NativeBuffer_Pool** pool);
+
+/**
+ * @brief Destroys a <b>OH_NativeBuffer_Pool</b>.\n
+ * The buffers already allocated from the pool stay valid, and the shared memory allocation is released after all
+ * of them are unreferenced, which may happen on any thread.\n
+ * The pool must not be passed to other interfaces after this interface is called.\n
+ * This interface is a thread-safe type interface.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool Indicates the pointer to a <b>OH_NativeBuffer_Pool</b> instance.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ * {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - pool is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_DestroyPool(OH_NativeBuffer_Pool* pool);
+
+/**
+ * @brief Allocates a <b>OH_NativeBuffer</b> that matches the passed config from a <b>OH_NativeBuffer_Pool</b>.\n
+ * The buffer is used in the same way as a buffer created by <b>OH_NativeBuffer_Alloc</b>, and its memory returns to
+ * the pool when it is unreferenced through <b>OH_NativeBuffer_Unreference</b>.
+ * When the buffer is written to an <b>OHIPCParcel</b> through <b>OH_NativeBuffer_WriteToParcel</b>, the file
+ * descriptor of the pool is shared together with the offset of the buffer, and a process that reads several buffers
+ * of the same pool maps the pool only once.
+ * As a result, the receiving process can map and access the memory of every buffer in the pool, including buffers
+ * that were never shared with it. Share pooled buffers only with processes that may access all buffers of the pool,
+ * and allocate buffers to be shared with other processes through <b>OH_NativeBuffer_Alloc</b>.\n
+ * This interface is a thread-safe type interface.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool Indicates the pointer to a <b>OH_NativeBuffer_Pool</b> instance.
+ * @param config Indicates the pointer to a <b>OH_NativeBuffer_Config</b> instance.
+ * @param buffer Indicates the pointer to the <b>OH_NativeBuffer</b> pointer allocated.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ * {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - pool, config or buffer is NULL, or the usage of config is not
+ *     contained in the usage of the pool.
+ * {@link NATIVE_ERROR_NO_BUFFER} 40601000 - the pool does not have enough free memory.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_AllocFromPool(OH_NativeBuffer_Pool* pool, const OH_NativeBuffer_Config* config,
+    OH_NativeBuffer** buffer);
+
+/**
+ * @brief Obtains the memory usage of a <b>OH_NativeBuffer_Pool</b>.\n
+ * This interface is a thread-safe type interface.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool Indicates the pointer to a <b>OH_NativeBuffer_Pool</b> instance.
+ * @param usedSize Indicates the size of the memory allocated to buffers, in bytes.
+ * @param largestFreeSize Indicates the size of the largest free block, in bytes.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ * {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - pool, usedSize or largestFreeSize is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_GetPoolUsage(OH_NativeBuffer_Pool* pool, uint64_t* usedSize, uint64_t* largestFreeSize);
 #ifdef __cplusplus
 }
 #endif
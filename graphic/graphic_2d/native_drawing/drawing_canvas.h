@@ -1177,6 +1177,37 @@ OH_Drawing_ErrorCode OH_Drawing_CanvasQuickRejectRect(OH_Drawing_Canvas* canvas,
  */
 OH_Drawing_ErrorCode OH_Drawing_CanvasIsOpaque(const OH_Drawing_Canvas* canvas, bool* isOpaque);
 
+/**
+ * @brief Draws many sprites from one image in a single batched draw call.
+ * Sprite i is the region srcRects[i] of the atlas image, transformed by xforms[i] and, if colors is not NULL, blended
+ * with colors[i] using the given blend mode. The sprites are drawn in array order with the brush currently attached
+ * to the canvas, and are recorded and submitted as one draw operation.
+ *
+ * @param canvas Pointer to the {@link OH_Drawing_Canvas} object.
+ * @param atlas Pointer to the {@link OH_Drawing_Image} object that holds all sprites.
+ * @param xforms Pointer to the array of {@link OH_Drawing_RSXform} transforms, one per sprite.
+ * @param srcRects Pointer to the rectangle array created by {@link OH_Drawing_RectCreateArray}, which holds the
+ * region of each sprite in the atlas image.
+ * @param colors Pointer to the array of colors in ARGB format, one per sprite. The array can be NULL.
+ * @param count Number of sprites. It must not exceed the size of **srcRects**.
+ * @param mode Blend mode used to combine the sprite colors with the atlas image. For details about the available
+ * options, see {@link OH_Drawing_BlendMode}. It is ignored if **colors** is NULL.
+ * @param samplingOptions Pointer to the {@link OH_Drawing_SamplingOptions} object. A null pointer means that the
+ * default sampling options are used.
+ * @param cullRect Pointer to the bounds of all sprites after transformation, which is used for quick rejection. The
+ * value can be NULL.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if any of **canvas**, **atlas**, **xforms** and **srcRects** is NULL.
+ * **OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE** if **count** exceeds the size of **srcRects** or **mode** is not one of
+ * the enumerated values.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawAtlas(OH_Drawing_Canvas* canvas, const OH_Drawing_Image* atlas,
+    const OH_Drawing_RSXform* xforms, OH_Drawing_Array* srcRects, const uint32_t* colors, size_t count,
+    OH_Drawing_BlendMode mode, const OH_Drawing_SamplingOptions* samplingOptions, const OH_Drawing_Rect* cullRect);
+
 #ifdef __cplusplus
 }
 #endif
@@ -855,6 +855,85 @@ OH_Drawing_ErrorCode OH_Drawing_FontSetThemeFontFollowed(OH_Drawing_Font* font,
  */
 OH_Drawing_ErrorCode OH_Drawing_FontIsThemeFontFollowed(const OH_Drawing_Font* font, bool* followed);
 
+/**
+ * @brief Defines the statistics of the process-level glyph cache, which holds the rasterized glyphs used by
+ * {@link OH_Drawing_CanvasDrawTextBlob} and {@link OH_Drawing_CanvasDrawSingleCharacter}.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct OH_Drawing_GlyphCacheStatistics {
+    /** Number of glyph lookups served from the cache. */
+    uint64_t hitCount;
+    /** Number of glyph lookups that had to rasterize the glyph. */
+    uint64_t missCount;
+    /** Number of glyphs currently held in the cache. */
+    uint32_t glyphCount;
+    /** Memory currently used by the cache, in bytes. */
+    size_t usedBytes;
+    /** Memory budget of the cache, in bytes. */
+    size_t budgetBytes;
+} OH_Drawing_GlyphCacheStatistics;
+
+/**
+ * @brief Sets the memory budget of the process-level glyph cache. When the budget is exceeded, the least recently
+ * used glyphs are evicted. The setting takes effect for the entire process.
+ *
+ * @param budgetBytes Memory budget of the glyph cache, in bytes. The value **0** means to restore the default budget.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_SetGlyphCacheBudget(size_t budgetBytes);
+
+/**
+ * @brief Sets the maximum memory that the glyphs of a typeface can occupy in the process-level glyph cache. When the
+ * limit is exceeded, the least recently used glyphs of the typeface are evicted, which keeps one typeface from
+ * evicting the glyphs of the others.
+ *
+ * @param typeface Pointer to an {@link OH_Drawing_Typeface} object.
+ * @param limitBytes Maximum memory for the glyphs of the typeface, in bytes. The value **0** means that the glyphs of
+ * the typeface are limited only by the budget set by {@link OH_Drawing_SetGlyphCacheBudget}.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if **typeface** is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_SetTypefaceGlyphCacheLimit(const OH_Drawing_Typeface* typeface, size_t limitBytes);
+
+/**
+ * @brief Obtains the statistics of the process-level glyph cache.
+ *
+ * @param statistics Pointer to the {@link OH_Drawing_GlyphCacheStatistics} object, which is used as an output
+ * parameter.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if **statistics** is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_GetGlyphCacheStatistics(OH_Drawing_GlyphCacheStatistics* statistics);
+
+/**
+ * @brief Rasterizes glyphs in advance and stores them in the process-level glyph cache, so that the first frames
+ * that draw them do not pay the rasterization cost. The glyphs are rasterized with the typeface, text size and other
+ * attributes of the font. Glyphs that are already cached are skipped.
+ *
+ * @param font Pointer to an {@link OH_Drawing_Font} object.
+ * @param glyphs Pointer to the start address of the glyph ID array. The glyph IDs can be obtained by calling
+ * {@link OH_Drawing_FontTextToGlyphs}.
+ * @param count Number of glyph IDs in the array.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if either **font** or **glyphs** is NULL, or **count** is **0**.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_FontPrewarmGlyphs(const OH_Drawing_Font* font, const uint16_t* glyphs,
+    uint32_t count);
+
 #ifdef __cplusplus
 }
 #endif
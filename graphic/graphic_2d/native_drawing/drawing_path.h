@@ -1062,6 +1062,58 @@ OH_Drawing_ErrorCode OH_Drawing_PathToggleInverseFillType(OH_Drawing_Path* path)
  */
 OH_Drawing_ErrorCode OH_Drawing_PathIsEqual(OH_Drawing_Path* path, OH_Drawing_Path* other, bool* equal);
 
+/**
+ * @brief Obtains the generation ID of a path. The generation ID changes each time the geometry of the path changes,
+ * and is the same for paths that share geometry after {@link OH_Drawing_PathCopy} or {@link OH_Drawing_PathSetPath}.
+ *
+ * @param path Pointer to an {@link OH_Drawing_Path} object.
+ * @param generationId Pointer to the generation ID, which is used as an output parameter.
+ * @return Returns the error code.
+ *         Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ *         Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if path or generationId is nullptr.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_PathGetGenerationId(const OH_Drawing_Path* path, uint32_t* generationId);
+
+/**
+ * @brief Sets whether to cache the tessellation of a path. When the cache is enabled, the tessellation generated
+ * when the path is drawn is kept, keyed by the generation ID of the path, and is reused by later draws whose matrix
+ * has the same scale, for example when the path is only translated or rotated. The cache is discarded when the
+ * geometry of the path changes or the cache is disabled. By default, the cache is disabled.
+ *
+ * @param path Pointer to an {@link OH_Drawing_Path} object.
+ * @param enabled Whether to cache the tessellation. The value **true** means to cache the tessellation, and
+ *                **false** means the opposite.
+ * @return Returns the error code.
+ *         Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ *         Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if path is nullptr.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_PathSetTessellationCacheEnabled(OH_Drawing_Path* path, bool enabled);
+
+/**
+ * @brief Combines a path with multiple paths based on the specified operation mode. All paths are processed in a
+ * single pass, which is faster than calling {@link OH_Drawing_PathOp} once for each path when combining large
+ * polygons. The result is the same as that of calling {@link OH_Drawing_PathOp} for each path in order.
+ *
+ * @param path Pointer to an {@link OH_Drawing_Path} object, in which the resulting path is saved.
+ * @param others Pointer to the array of {@link OH_Drawing_Path} objects to combine with.
+ * @param count Number of paths in the array.
+ * @param op Operation mode of the path. For details about the available options, see {@link OH_Drawing_PathOpMode}.
+ * @param isEmpty Whether the resulting path is empty, which is used as an output parameter.
+ * @return Returns the error code.
+ *         Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ *         Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if path, others, an element of others or isEmpty
+ *         is nullptr, or count is 0.
+ *         Returns {@link OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE} if op is not one of the enumerated values.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_PathOpMultiple(OH_Drawing_Path* path, const OH_Drawing_Path* const* others,
+    size_t count, OH_Drawing_PathOpMode op, bool* isEmpty);
+
 #ifdef __cplusplus
 }
 #endif
@@ -117,6 +117,122 @@ OH_Drawing_ErrorCode OH_Drawing_RecordCmdUtilsFinishRecording(OH_Drawing_RecordC
  */
 OH_Drawing_ErrorCode OH_Drawing_RecordCmdDestroy(OH_Drawing_RecordCmd* recordCmd);
 
+/**
+ * @brief Serializes an **OH_Drawing_RecordCmd** object into a compact binary buffer, which can be stored, for example
+ * on disk, and restored later through {@link OH_Drawing_RecordCmdCreateFromStream}.
+ * Images and typefaces used by several drawing commands are stored only once.
+ * If **buffer** is NULL, only the size of the serialized data is returned through **dataSize**.
+ *
+ * @param recordCmd Pointer to an {@link OH_Drawing_RecordCmd} object.
+ * @param buffer Pointer to the buffer that receives the serialized data. The value can be NULL.
+ * @param bufferSize Size of the buffer, in bytes.
+ * @param dataSize Pointer to the size of the serialized data, in bytes, which is used as an output parameter.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if either **recordCmd** or **dataSize** is NULL.
+ * **OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE** if **buffer** is not NULL and **bufferSize** is less than the size of
+ * the serialized data.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdSerialize(const OH_Drawing_RecordCmd* recordCmd, void* buffer,
+    size_t bufferSize, size_t* dataSize);
+
+/**
+ * @brief Creates an **OH_Drawing_RecordCmd** object from data serialized by {@link OH_Drawing_RecordCmdSerialize}.
+ * The data is copied, and the ownership of the memory stream is not transferred. Whether this function succeeds or
+ * fails, you need to call {@link OH_Drawing_MemoryStreamDestroy} to release the memory stream, which can be done
+ * as soon as this function returns.
+ *
+ * @param memoryStream Pointer to an {@link OH_Drawing_MemoryStream} object that holds the serialized data.
+ * @param recordCmd Double pointer to the {@link OH_Drawing_RecordCmd} object created. You need to call
+ * {@link OH_Drawing_RecordCmdDestroy} to release it.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if either **memoryStream** or **recordCmd** is NULL.
+ * **OH_DRAWING_ERROR_FILE_CORRUPTED** if the data is corrupted or was serialized by an incompatible version.
+ * **OH_DRAWING_ERROR_ALLOCATION_FAILED** if the system memory is insufficient.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdCreateFromStream(const OH_Drawing_MemoryStream* memoryStream,
+    OH_Drawing_RecordCmd** recordCmd);
+
+/**
+ * @brief Obtains the bounds of all drawing commands recorded in an **OH_Drawing_RecordCmd** object.
+ *
+ * @param recordCmd Pointer to an {@link OH_Drawing_RecordCmd} object.
+ * @param bounds Pointer to the {@link OH_Drawing_Rect} object, which is used as an output parameter.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if either **recordCmd** or **bounds** is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdGetBounds(const OH_Drawing_RecordCmd* recordCmd, OH_Drawing_Rect* bounds);
+
+/**
+ * @brief Obtains the number of drawing commands recorded in an **OH_Drawing_RecordCmd** object.
+ *
+ * @param recordCmd Pointer to an {@link OH_Drawing_RecordCmd} object.
+ * @param opCount Pointer to the number of drawing commands, which is used as an output parameter.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if either **recordCmd** or **opCount** is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdGetOpCount(const OH_Drawing_RecordCmd* recordCmd, uint32_t* opCount);
+
+/**
+ * @brief Rasterizes an **OH_Drawing_RecordCmd** object into a bitmap on the CPU. The bitmap is split into tiles, and
+ * the tiles are rasterized in parallel. Drawing commands whose bounds do not intersect a tile are skipped for that
+ * tile. The result does not depend on the tile size or the number of threads: it is identical, pixel for pixel, to
+ * that of calling this function with **threadCount** set to **1** and a single tile covering the whole bitmap, which
+ * replays the drawing commands serially, in recording order, on one canvas bound to the bitmap.
+ *
+ * @param recordCmd Pointer to an {@link OH_Drawing_RecordCmd} object.
+ * @param bitmap Pointer to the {@link OH_Drawing_Bitmap} object to draw into. The pixels of the bitmap must have been
+ * allocated.
+ * @param tileWidth Tile width, in px. If the value is **0**, the system selects a tile width.
+ * @param tileHeight Tile height, in px. If the value is **0**, the system selects a tile height.
+ * @param threadCount Maximum number of threads used for rasterization. If the value is **0**, the system selects the
+ * number of threads. If the value is **1**, the tiles are rasterized on the calling thread.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if either **recordCmd** or **bitmap** is NULL, or the pixels of
+ * **bitmap** have not been allocated.
+ * **OH_DRAWING_ERROR_ALLOCATION_FAILED** if the system memory is insufficient.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdRasterizeToBitmap(const OH_Drawing_RecordCmd* recordCmd,
+    OH_Drawing_Bitmap* bitmap, uint32_t tileWidth, uint32_t tileHeight, uint32_t threadCount);
+
+/**
+ * @brief Rasterizes an **OH_Drawing_RecordCmd** object into a pixel map on the CPU. The pixel map is split into tiles,
+ * and the tiles are rasterized in parallel. Drawing commands whose bounds do not intersect a tile are skipped for
+ * that tile. The result does not depend on the tile size or the number of threads: it is identical, pixel for pixel,
+ * to that of calling this function with **threadCount** set to **1** and a single tile covering the whole pixel map,
+ * which replays the drawing commands serially, in recording order, on one canvas created by
+ * {@link OH_Drawing_CanvasCreateWithPixelMap} from the pixel map.
+ *
+ * @param recordCmd Pointer to an {@link OH_Drawing_RecordCmd} object.
+ * @param pixelMap Pointer to the {@link OH_Drawing_PixelMap} object to draw into.
+ * @param tileWidth Tile width, in px. If the value is **0**, the system selects a tile width.
+ * @param tileHeight Tile height, in px. If the value is **0**, the system selects a tile height.
+ * @param threadCount Maximum number of threads used for rasterization. If the value is **0**, the system selects the
+ * number of threads. If the value is **1**, the tiles are rasterized on the calling thread.
+ * @return Returns one of the following result codes:
+ * **OH_DRAWING_SUCCESS** if the operation is successful.
+ * **OH_DRAWING_ERROR_INCORRECT_PARAMETER** if either **recordCmd** or **pixelMap** is NULL.
+ * **OH_DRAWING_ERROR_ALLOCATION_FAILED** if the system memory is insufficient.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdRasterizeToPixelMap(const OH_Drawing_RecordCmd* recordCmd,
+    OH_Drawing_PixelMap* pixelMap, uint32_t tileWidth, uint32_t tileHeight, uint32_t threadCount);
+
 #ifdef __cplusplus
 }
 #endif
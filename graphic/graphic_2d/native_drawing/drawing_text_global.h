@@ -41,6 +41,9 @@
 #ifndef DRAWING_TEXT_GLOBAL_H
 #define DRAWING_TEXT_GLOBAL_H
 
+#include <stdint.h>
+#include "drawing_error_code.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -110,6 +113,60 @@ void OH_Drawing_SetTextHighContrast(OH_Drawing_TextHighContrast action);
  * @since 20
  */
 void OH_Drawing_SetTextUndefinedGlyphDisplay(OH_Drawing_TextUndefinedGlyphDisplay undefinedGlyphDisplay);
+
+/**
+ * @brief Defines the statistics of the process-level shaping cache.
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_Drawing_ShapingCacheStatistics {
+    /** Number of shaping requests served from the cache. */
+    uint64_t hitCount;
+    /** Number of shaping requests that had to shape the text. */
+    uint64_t missCount;
+    /** Number of shaped runs currently held in the cache. */
+    uint32_t entryCount;
+    /** Maximum number of shaped runs the cache can hold. */
+    uint32_t capacity;
+} OH_Drawing_ShapingCacheStatistics;
+
+/**
+ * @brief Sets the capacity of the process-level shaping cache.
+ * <br>The cache keeps shaped runs keyed by the text, the text style and the font collection, so that typographies
+ * created for the same strings, for example labels and timestamps in lists, reuse the shaping result instead of
+ * shaping the text again. When the cache is full, the least recently used runs are evicted.
+ * <br>The setting of this API takes effect for the entire process.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param capacity Maximum number of shaped runs held in the cache. The value **0** disables the cache and releases the
+ *     shaped runs it holds.
+ * @return Returns the error code.
+ *     Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ * @since 26.1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_SetShapingCacheCapacity(uint32_t capacity);
+
+/**
+ * @brief Obtains the statistics of the process-level shaping cache.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param statistics Pointer to the {@link OH_Drawing_ShapingCacheStatistics} object, which is used as an output
+ *     parameter.
+ * @return Returns the error code.
+ *     Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if statistics is nullptr.
+ * @since 26.1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_GetShapingCacheStatistics(OH_Drawing_ShapingCacheStatistics* statistics);
+
+/**
+ * @brief Releases all shaped runs held in the process-level shaping cache and resets its statistics.
+ * The capacity of the cache is not changed.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @since 26.1.0
+ */
+void OH_Drawing_ClearShapingCache(void);
 #ifdef __cplusplus
 }
 #endif
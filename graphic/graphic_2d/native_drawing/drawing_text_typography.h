@@ -1894,6 +1894,8 @@ void OH_Drawing_DestroyTypography(OH_Drawing_Typography* typography);
 /**
  * @brief Performs layout calculation on the typography object and wraps text based on the specified maximum width.
  * After this API is called, the properties of the typography object can be correctly obtained.
+ * Since API version 26.1.0, different typography objects can be laid out concurrently on different threads, even if
+ * they share the same {@link OH_Drawing_FontCollection}. The same typography object must not be laid out concurrently.
  *
  * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
  * @param typography Pointer to the {@link OH_Drawing_Typography} object, which is obtained from
@@ -4350,6 +4352,48 @@ OH_Drawing_Range* OH_Drawing_TypographyGetGlyphRangeForCharacterRangeWithBuffer(
  * @since 24
  */
 void OH_Drawing_ReleaseRangeBuffer(OH_Drawing_Range* range);
+
+/**
+ * @brief Lays out a typography again at a new maximum width, reusing the shaping result of the previous layout.
+ * Only line breaking, alignment and the line metrics are computed again, so the text is not shaped again. This
+ * function must be called after {@link OH_Drawing_TypographyLayout} is called. If the text style has been updated
+ * since the previous layout, for example through {@link OH_Drawing_TypographyUpdateFontSize}, the typography is laid
+ * out in full.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param typography Pointer to the **OH_Drawing_Typography** object, which is obtained from
+ *     {@link OH_Drawing_CreateTypography}.
+ * @param maxWidth Maximum width of a single line, in physical pixels (px). The value must be greater than 0.
+ * @return Returns the error code.
+ *     Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if typography is nullptr or has not been laid out.
+ *     Returns {@link OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE} if maxWidth is not greater than 0.
+ * @since 26.1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_TypographyRelayout(OH_Drawing_Typography* typography, double maxWidth);
+
+/**
+ * @brief Lays out a batch of typography objects in parallel on the system worker pool.
+ * Each typography is laid out as if {@link OH_Drawing_TypographyLayout} were called with the corresponding maximum
+ * width. This function returns after all typography objects have been laid out. The typography objects must be
+ * different from each other and must not be accessed by other threads during the call. They may share the same
+ * {@link OH_Drawing_FontCollection}.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param typographies Pointer to the array of {@link OH_Drawing_Typography} objects, which are obtained from
+ *     {@link OH_Drawing_CreateTypography}.
+ * @param maxWidths Pointer to the array of maximum widths of a single line, in physical pixels (px). Its length must be
+ *     equal to **count**, and each value must be greater than 0.
+ * @param count Number of typography objects.
+ * @return Returns the error code.
+ *     Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if typographies or maxWidths is nullptr, an element of
+ *     typographies is nullptr, or count is 0.
+ *     Returns {@link OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE} if a maximum width is not greater than 0.
+ * @since 26.1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_TypographyLayoutBatch(OH_Drawing_Typography** typographies, const double* maxWidths,
+    size_t count);
 #ifdef __cplusplus
 }
 #endif
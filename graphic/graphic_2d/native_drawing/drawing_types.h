@@ -166,6 +166,25 @@ typedef struct {
     float z;
 } OH_Drawing_Point3D;
 
+/**
+ * @brief Defines a rotation-scale-translation transform, which is equivalent to the matrix
+ * [scaleCos, -scaleSin, translateX; scaleSin, scaleCos, translateY; 0, 0, 1].
+ * It is used to place a sprite in {@link OH_Drawing_CanvasDrawAtlas}.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct {
+    /** Cosine of the rotation angle multiplied by the scale factor. */
+    float scaleCos;
+    /** Sine of the rotation angle multiplied by the scale factor. */
+    float scaleSin;
+    /** Translation on the x-axis. */
+    float translateX;
+    /** Translation on the y-axis. */
+    float translateY;
+} OH_Drawing_RSXform;
+
 /**
  * @brief Defines a struct for a path effect that affects the stroke.
  *
@@ -192,6 +192,222 @@ int OH_NativeVSync_DVSyncSwitch(OH_NativeVSync* nativeVsync, bool enable);
  * @version 1.0
  */
 int OH_NativeVSync_SetExpectedFrameRateRange(OH_NativeVSync* nativeVsync, OH_NativeVSync_ExpectedRateRange* range);
+
+/**
+ * @brief Defines the native window.
+ * @since 8
+ */
+typedef struct NativeWindow OHNativeWindow;
+/**
+ * @brief define the new type name OHNativeWindowBuffer for struct NativeWindowBuffer.
+ * @since 12
+ */
+typedef struct NativeWindowBuffer OHNativeWindowBuffer;
+
+/**
+ * @brief Defines a frame scheduler, which ties an <b>OH_NativeVSync</b> instance to a <b>NativeWindow</b> instance to
+ * pace the frames rendered into the window.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct OH_NativeVSync_FrameScheduler OH_NativeVSync_FrameScheduler;
+
+/**
+ * @brief Defines the information of a frame scheduled by an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct {
+    /** ID of the frame, which increases by one for each scheduled frame. */
+    uint64_t frameId;
+    /** Timestamp of the vsync signal that the frame belongs to, in nanoseconds. */
+    int64_t vsyncTimestamp;
+    /** Expected presentation time of the frame, in nanoseconds. */
+    int64_t targetPresentTimestamp;
+    /** Render duration predicted from the previous frames, in nanoseconds. */
+    int64_t predictedRenderDuration;
+} OH_NativeVSync_FrameInfo;
+
+/**
+ * @brief Defines the statistics of a frame submitted through <b>OH_NativeVSync_FrameScheduler_SubmitFrame</b>.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct {
+    /** ID of the frame. */
+    uint64_t frameId;
+    /** Time from the start of rendering to the submission of the frame, in nanoseconds. */
+    int64_t renderDuration;
+    /** Time from the vsync signal that the frame belongs to until the frame is presented, in nanoseconds. */
+    int64_t latency;
+    /** Whether the frame missed its expected presentation time. */
+    bool missed;
+} OH_NativeVSync_FrameStats;
+
+/**
+ * @brief Defines the callback function that is called when a frame is to be rendered.
+ * The buffer has already been requested from the window, so rendering does not block on buffer dequeue.
+ * The ownership of <b>fenceFd</b> is transferred to the callback. When the fenceFd is used up, you need to close it.
+ * The callback is called on the callback thread of the <b>OH_NativeVSync</b> instance, one frame at a time, and never
+ * concurrently with <b>OH_NativeVSync_FrameScheduler_OnFrameStats</b>. The buffer does not have to be returned
+ * before the callback returns; it is returned through <b>OH_NativeVSync_FrameScheduler_SubmitFrame</b> or
+ * <b>OH_NativeVSync_FrameScheduler_SkipFrame</b>, which can be called on any thread.
+ *
+ * @param scheduler Indicates the pointer to an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * @param buffer Indicates the pointer to the window buffer to render into.
+ * @param fenceFd Indicates the file descriptor of the fence to wait on before writing to the buffer.
+ *     The value <b>-1</b> means that the buffer can be written directly.
+ * @param info Indicates the pointer to the information of the frame.
+ * @param data Indicates the user data passed when the scheduler is started.
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef void (*OH_NativeVSync_FrameScheduler_OnFrame)(OH_NativeVSync_FrameScheduler* scheduler,
+    OHNativeWindowBuffer* buffer, int fenceFd, const OH_NativeVSync_FrameInfo* info, void* data);
+
+/**
+ * @brief Defines the callback function that reports the statistics of a frame after it is presented.
+ * The callback is called on the callback thread of the <b>OH_NativeVSync</b> instance, and never concurrently with
+ * <b>OH_NativeVSync_FrameScheduler_OnFrame</b>.
+ *
+ * @param scheduler Indicates the pointer to an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * @param stats Indicates the pointer to the statistics of the frame.
+ * @param data Indicates the user data passed when the callback is set.
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef void (*OH_NativeVSync_FrameScheduler_OnFrameStats)(OH_NativeVSync_FrameScheduler* scheduler,
+    const OH_NativeVSync_FrameStats* stats, void* data);
+
+/**
+ * @brief Creates an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * The scheduler requests vsync signals from <b>nativeVsync</b> and buffers from <b>window</b>. While the scheduler
+ * exists, do not request vsync signals from <b>nativeVsync</b> or buffers from <b>window</b> by yourself.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param nativeVsync Indicates the pointer to a NativeVsync.
+ * @param window Indicates the pointer to a <b>NativeWindow</b> instance.
+ * @return Returns the pointer to the <b>OH_NativeVSync_FrameScheduler</b> instance created.
+ *     Returns <b>NULL</b> if nativeVsync or window is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_NativeVSync_FrameScheduler* OH_NativeVSync_FrameScheduler_Create(OH_NativeVSync* nativeVsync,
+    OHNativeWindow* window);
+
+/**
+ * @brief Destroys an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * The scheduler is stopped in the same way as <b>OH_NativeVSync_FrameScheduler_Stop</b>: the buffer it has requested
+ * but not delivered, and the buffers delivered through <b>OH_NativeVSync_FrameScheduler_OnFrame</b> but not yet
+ * submitted or skipped, are returned to the window without being presented.
+ * Do not call this interface in the callbacks of the scheduler, and do not use the scheduler after it is destroyed.
+ * The <b>OH_NativeVSync</b> and <b>NativeWindow</b> instances are not destroyed.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler Indicates the pointer to an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * @since 26.1.0
+ * @version 1.0
+ */
+void OH_NativeVSync_FrameScheduler_Destroy(OH_NativeVSync_FrameScheduler* scheduler);
+
+/**
+ * @brief Starts frame scheduling.
+ * For each vsync period, the scheduler requests the next buffer in advance, predicts the render duration from the
+ * previous frames, and calls <b>callback</b> at the offset from the vsync signal that leaves enough time for the frame
+ * to be presented in time.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler Indicates the pointer to an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * @param callback Indicates the callback function called when a frame is to be rendered.
+ * @param data Indicates data which will be used in callback.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - the parameter scheduler is NULL or callback is NULL.
+ *     {@link NATIVE_ERROR_INVALID_OPERATION} 41201000 - the scheduler has been started.
+ *     {@link NATIVE_ERROR_BINDER_ERROR} 50401000 - ipc send failed.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_Start(OH_NativeVSync_FrameScheduler* scheduler,
+    OH_NativeVSync_FrameScheduler_OnFrame callback, void* data);
+
+/**
+ * @brief Stops frame scheduling.
+ * The buffer requested but not delivered, and the buffers delivered through
+ * <b>OH_NativeVSync_FrameScheduler_OnFrame</b> but not yet submitted or skipped, are returned to the window without
+ * being presented. A later <b>OH_NativeVSync_FrameScheduler_SubmitFrame</b> or
+ * <b>OH_NativeVSync_FrameScheduler_SkipFrame</b> for such a buffer returns
+ * {@link NATIVE_ERROR_BUFFER_STATE_INVALID}, and the fenceFd passed to
+ * <b>OH_NativeVSync_FrameScheduler_SubmitFrame</b> is still closed.
+ * When called outside the callbacks of the scheduler, this interface returns after the running callback, if any,
+ * has returned.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler Indicates the pointer to an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - the parameter scheduler is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_Stop(OH_NativeVSync_FrameScheduler* scheduler);
+
+/**
+ * @brief Submits a rendered frame. The buffer is flushed to the window with the target presentation time of the
+ * frame, and the render duration is recorded for the prediction of the next frames.
+ * Each buffer delivered through <b>OH_NativeVSync_FrameScheduler_OnFrame</b> must be either submitted through this
+ * interface or skipped through <b>OH_NativeVSync_FrameScheduler_SkipFrame</b> exactly once, unless the scheduler is
+ * stopped first. This interface can be called on any thread.
+ * The fenceFd will be closed by system, including when an error is returned.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler Indicates the pointer to an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * @param buffer Indicates the pointer to the window buffer delivered through the callback.
+ * @param fenceFd Indicates the file descriptor of the fence signaled when rendering into the buffer is complete.
+ *     The value <b>-1</b> means that rendering is already complete.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - the parameter scheduler is NULL or buffer is NULL.
+ *     {@link NATIVE_ERROR_BUFFER_STATE_INVALID} 41207000 - the buffer was not delivered by the scheduler, has been
+ *     submitted or skipped, or was returned to the window when the scheduler was stopped.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_SubmitFrame(OH_NativeVSync_FrameScheduler* scheduler,
+    OHNativeWindowBuffer* buffer, int fenceFd);
+
+/**
+ * @brief Skips a frame. The buffer is returned to the window without being presented, so the window keeps showing
+ * the previous frame, and the frame is not used for the prediction of the next frames.
+ * Use this interface instead of <b>OH_NativeVSync_FrameScheduler_SubmitFrame</b> when a frame delivered through
+ * <b>OH_NativeVSync_FrameScheduler_OnFrame</b> is not to be rendered. This interface can be called on any thread.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler Indicates the pointer to an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * @param buffer Indicates the pointer to the window buffer delivered through the callback.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - the parameter scheduler is NULL or buffer is NULL.
+ *     {@link NATIVE_ERROR_BUFFER_STATE_INVALID} 41207000 - the buffer was not delivered by the scheduler, has been
+ *     submitted or skipped, or was returned to the window when the scheduler was stopped.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_SkipFrame(OH_NativeVSync_FrameScheduler* scheduler, OHNativeWindowBuffer* buffer);
+
+/**
+ * @brief Sets the callback function that reports the statistics of each presented frame.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler Indicates the pointer to an <b>OH_NativeVSync_FrameScheduler</b> instance.
+ * @param callback Indicates the callback function. The value <b>NULL</b> means to stop reporting statistics.
+ * @param data Indicates data which will be used in callback.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - the parameter scheduler is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_SetFrameStatsCallback(OH_NativeVSync_FrameScheduler* scheduler,
+    OH_NativeVSync_FrameScheduler_OnFrameStats callback, void* data);
 #ifdef __cplusplus
 }
 #endif
@@ -39,6 +39,7 @@
 #ifndef NDK_INCLUDE_EXTERNAL_NATIVE_WINDOW_H_
 #define NDK_INCLUDE_EXTERNAL_NATIVE_WINDOW_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "buffer_handle.h"
 #include "../native_buffer/buffer_common.h"
@@ -984,6 +985,88 @@ int32_t OH_NativeWindow_Set3DMetadataValue(OHNativeWindow *window, OH_NativeBuff
  */
 int32_t OH_NativeWindow_Get3DMetadataValue(OHNativeWindow *window, OH_NativeBuffer_3D_MetadataKey metadataKey,
     int32_t *size, uint8_t **metadata);
+
+/**
+ * @brief Indicates the number of buckets in the request wait time histogram of <b>OHNativeWindowBufferQueueStats</b>.
+ * @since 26.1.0
+ */
+#define OH_NATIVE_WINDOW_WAIT_HISTOGRAM_BUCKET_COUNT 8
+
+/**
+ * @brief Defines the buffer queue statistics of a native window.
+ * The statistics are collected from the creation of the window or the last call to
+ * <b>OH_NativeWindow_ResetBufferQueueStats</b>.
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Number of buffers in the buffer queue. */
+    uint32_t queueSize;
+    /** Number of buffers currently requested by the producer or flushed but not yet released by the consumer. */
+    uint32_t buffersInFlight;
+    /** Number of buffer requests. */
+    uint64_t requestCount;
+    /**
+     * Number of buffer requests by wait time. The upper bounds of the buckets are 1 ms, 2 ms, 4 ms, 8 ms, 16 ms,
+     * 33 ms and 66 ms, and the last bucket counts the requests that waited longer than 66 ms.
+     */
+    uint64_t requestWaitHistogram[OH_NATIVE_WINDOW_WAIT_HISTOGRAM_BUCKET_COUNT];
+    /** Maximum wait time of a buffer request, in nanoseconds. */
+    int64_t maxRequestWaitTime;
+    /** Average time from the flush of a buffer to its acquisition by the consumer, in nanoseconds. */
+    int64_t averageFlushToAcquireLatency;
+    /** Maximum time from the flush of a buffer to its acquisition by the consumer, in nanoseconds. */
+    int64_t maxFlushToAcquireLatency;
+    /** Number of flushed buffers that were dropped without being consumed. */
+    uint64_t droppedBufferCount;
+} OHNativeWindowBufferQueueStats;
+
+/**
+ * @brief Obtains the buffer queue statistics of a native window.\n
+ * This interface is a non-thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeWindow
+ * @param window Indicates the pointer to a <b>OHNativeWindow</b> instance.
+ * @param stats Indicates the pointer to a <b>OHNativeWindowBufferQueueStats</b> instance, which is used as an
+ *     output parameter.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - window or stats is NULL.
+ *     {@link NATIVE_ERROR_UNKNOWN} 50002000 - surface of window is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeWindow_GetBufferQueueStats(OHNativeWindow *window, OHNativeWindowBufferQueueStats *stats);
+
+/**
+ * @brief Resets the buffer queue statistics of a native window.\n
+ * This interface is a non-thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeWindow
+ * @param window Indicates the pointer to a <b>OHNativeWindow</b> instance.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - window is NULL.
+ *     {@link NATIVE_ERROR_UNKNOWN} 50002000 - surface of window is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeWindow_ResetBufferQueueStats(OHNativeWindow *window);
+
+/**
+ * @brief Sets whether to emit HiTrace spans for the buffer state transitions of a native window.\n
+ * When enabled and tracing is on, a span is emitted for each buffer from request to flush, from flush to acquisition
+ * by the consumer and from acquisition to release, tagged with the sequence number of the buffer.
+ * By default, the spans are not emitted.\n
+ * This interface is a non-thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeWindow
+ * @param window Indicates the pointer to a <b>OHNativeWindow</b> instance.
+ * @param enabled Whether to emit the spans. The value true means to emit the spans, and false means the opposite.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - window is NULL.
+ *     {@link NATIVE_ERROR_UNKNOWN} 50002000 - surface of window is NULL.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeWindow_SetBufferTraceEnabled(OHNativeWindow *window, bool enabled);
 #ifdef __cplusplus
 }
 #endif
@@ -553,6 +553,102 @@ Image_ErrorCode OH_ImagePackerNative_Release(OH_ImagePackerNative *imagePacker);
  */
 Image_ErrorCode OH_ImagePackerNative_GetSupportedFormats(Image_MimeType** supportedFormats, size_t* length);
 
+/**
+ * @brief Defines a callback invoked when a chunk of encoded data is ready during streaming encoding.
+ * The data is valid only during the callback and must be copied or written out before the callback returns.
+ *
+ * @param data Pointer to the chunk of encoded data.
+ * @param size Size of the chunk, in bytes.
+ * @param userData Pointer to user specific data.
+ * @return **true** to continue encoding; **false** to abort it, in which case the packing function returns
+ *     {@link IMAGE_ENCODE_FAILED}.
+ * @since 26.1.0
+ */
+typedef bool (*OH_ImagePackerNative_OnDataChunk)(const uint8_t *data, size_t size, void *userData);
+
+/**
+ * @brief Sets the maximum number of threads used to encode one image.
+ * For formats that allow it, for example JPEG with restart markers and HEIF with tiles, the image is split into
+ * strips or tiles that are encoded in parallel. For other formats the image is encoded on one thread.
+ *
+ * @param options Pointer to an OH_PackingOptions struct.
+ * @param threadCount Maximum number of encoding threads. The value **0** means that the system decides the number
+ *     based on the number of CPU cores. The default value is **1**.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_PACKER_INVALID_PARAMETER} options is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PackingOptions_SetEncodingThreadCount(OH_PackingOptions *options, uint32_t threadCount);
+
+/**
+ * @brief Obtains the maximum number of threads used to encode one image.
+ *
+ * @param options Pointer to an OH_PackingOptions struct.
+ * @param threadCount Pointer to the maximum number of encoding threads.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_PACKER_INVALID_PARAMETER} options or threadCount is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PackingOptions_GetEncodingThreadCount(OH_PackingOptions *options, uint32_t *threadCount);
+
+/**
+ * @brief Sets the size of the chunks in which encoded data is delivered during streaming encoding.
+ * It applies to {@link OH_ImagePackerNative_PackToStreamFromPixelmap} and to the functions that encode into a file.
+ * The encoder holds at most about one chunk of output per encoding thread in memory.
+ *
+ * @param options Pointer to an OH_PackingOptions struct.
+ * @param chunkSize Chunk size, in bytes. The value **0** means that the system decides the size.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_PACKER_INVALID_PARAMETER} options is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PackingOptions_SetOutputChunkSize(OH_PackingOptions *options, size_t chunkSize);
+
+/**
+ * @brief Obtains the size of the chunks in which encoded data is delivered during streaming encoding.
+ *
+ * @param options Pointer to an OH_PackingOptions struct.
+ * @param chunkSize Pointer to the chunk size, in bytes. The value **0** means that the system decides the size.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_PACKER_INVALID_PARAMETER} options or chunkSize is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PackingOptions_GetOutputChunkSize(OH_PackingOptions *options, size_t *chunkSize);
+
+/**
+ * @brief Encodes a PixelMap and delivers the encoded data in chunks through a callback.
+ * The whole encoded image is never held in memory, which allows large images to be exported with bounded memory.
+ * The callback is invoked on the calling thread, in output order. This function returns after the last chunk has been
+ * delivered.
+ *
+ * @param imagePacker Pointer to OH_ImagePackerNative.
+ * @param options Pointer to an OH_PackingOptions struct.
+ * @param pixelmap Pointer to the PixelMap to encode.
+ * @param callback Callback invoked for each chunk of encoded data, see {@link OH_ImagePackerNative_OnDataChunk}.
+ * @param userData Pointer to user specific data.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_PACKER_INVALID_PARAMETER} imagePacker, options, pixelmap or callback is nullptr.
+ *     <br>{@link IMAGE_ENCODE_FAILED} encode failed, or the callback aborted the encoding.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImagePackerNative_PackToStreamFromPixelmap(OH_ImagePackerNative *imagePacker,
+    OH_PackingOptions *options, OH_PixelmapNative *pixelmap, OH_ImagePackerNative_OnDataChunk callback,
+    void *userData);
+
+/**
+ * @brief Sets whether an image packer keeps its encoder instance between packing calls.
+ * When enabled, consecutive calls with the same format, quality and dynamic range reuse the encoder instance instead
+ * of creating a new one for each call. The cached instance is released when the options change or when the image
+ * packer is released.
+ *
+ * @param imagePacker Pointer to OH_ImagePackerNative.
+ * @param enabled Whether to keep the encoder instance. The default value is **false**.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_PACKER_INVALID_PARAMETER} imagePacker is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImagePackerNative_SetEncoderCacheEnabled(OH_ImagePackerNative *imagePacker, bool enabled);
+
 #ifdef __cplusplus
 };
 #endif
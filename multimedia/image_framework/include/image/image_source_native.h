@@ -1170,6 +1170,271 @@ Image_ErrorCode OH_ImageSourceNative_GetBitsPerPixelFromRawData(const OH_ImageRa
  */
 Image_ErrorCode OH_ImageSourceNative_DestroyImageRawData(OH_ImageRawData *rawData);
 
+/**
+ * @brief Defines a tile decoder of an image source.
+ * A tile decoder parses the image source once and keeps the parsed stream state, so that arbitrary regions of a
+ * large image can be decoded repeatedly without parsing the source again.
+ * It is created by calling {@link OH_ImageSourceNative_CreateTileDecoder}.
+ *
+ * @since 26.1.0
+ */
+struct OH_ImageSourceTileDecoder;
+
+/**
+ * @brief Defines a tile decoder of an image source.
+ * It is created by calling {@link OH_ImageSourceNative_CreateTileDecoder}.
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_ImageSourceTileDecoder OH_ImageSourceTileDecoder;
+
+/**
+ * @brief Defines a callback invoked when a progressive pass of a tile is decoded.
+ * For progressive JPEG images each pass corresponds to a scan, and for interlaced PNG images each pass corresponds to
+ * an Adam7 pass. The tile is refined in place, so the same pixelmap is passed to every invocation.
+ *
+ * @param decoder Pointer to the OH_ImageSourceTileDecoder object.
+ * @param passIndex Index of the pass that has been decoded, starting from 0.
+ * @param passCount Total number of passes of the image.
+ * @param pixelmap Pointer to the tile pixelmap refined by the pass. It is owned by the caller of
+ *     {@link OH_ImageSourceTileDecoder_DecodeTileProgressive}.
+ * @param userData Pointer to user specific data.
+ * @since 26.1.0
+ */
+typedef void (*OH_ImageSourceTileDecoder_OnPassDecoded)(OH_ImageSourceTileDecoder *decoder, uint32_t passIndex,
+    uint32_t passCount, OH_PixelmapNative *pixelmap, void *userData);
+
+/**
+ * @brief Creates a tile decoder for an image source.
+ * The image source is parsed once when the tile decoder is created. The tile decoder holds a reference to the image
+ * source, which must not be released before the tile decoder is released.
+ *
+ * @param source Pointer to an OH_ImageSourceNative object.
+ * @param decoder Double pointer to the OH_ImageSourceTileDecoder object created.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} source or decoder is nullptr.
+ *     <br>{@link IMAGE_BAD_SOURCE} the image source fails to be parsed.
+ *     <br>{@link IMAGE_SOURCE_UNSUPPORTED_MIME_TYPE} the image format does not support tile decoding.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceNative_CreateTileDecoder(OH_ImageSourceNative *source,
+    OH_ImageSourceTileDecoder **decoder);
+
+/**
+ * @brief Obtains the number of scale levels supported by a tile decoder.
+ * Level 0 is the original size, and each following level halves the width and height of the previous one. Levels
+ * that can be produced directly by the codec, for example DCT-domain downscaling of JPEG images, are decoded without
+ * decoding the full resolution data.
+ *
+ * @param decoder Pointer to an OH_ImageSourceTileDecoder object.
+ * @param levelCount Pointer to the number of scale levels obtained.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} decoder or levelCount is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_GetScaleLevelCount(OH_ImageSourceTileDecoder *decoder,
+    uint32_t *levelCount);
+
+/**
+ * @brief Obtains the image size at a scale level of a tile decoder.
+ *
+ * @param decoder Pointer to an OH_ImageSourceTileDecoder object.
+ * @param level Scale level, in the range [0, levelCount).
+ * @param size Pointer to the image size at the scale level.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} decoder or size is nullptr, or level is out of range.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_GetScaleLevelSize(OH_ImageSourceTileDecoder *decoder, uint32_t level,
+    Image_Size *size);
+
+/**
+ * @brief Decodes a tile of the image at a scale level.
+ * Only the data covering the tile is decoded. This function can be called concurrently from multiple threads on the
+ * same tile decoder to decode different tiles in parallel.
+ *
+ * @param decoder Pointer to an OH_ImageSourceTileDecoder object.
+ * @param level Scale level, in the range [0, levelCount).
+ * @param region Pointer to the tile region, in the coordinates of the image at the scale level.
+ * @param options Pointer to the decoding options. Only the pixel format, allocator and dynamic range options take
+ *     effect. If options is nullptr, the default options are used.
+ * @param pixelmap Double pointer to the OH_PixelmapNative object created.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} decoder, region or pixelmap is nullptr, or level is out of range.
+ *     <br>{@link IMAGE_INVALID_REGION} the region is out of the image at the scale level.
+ *     <br>{@link IMAGE_SOURCE_UNSUPPORTED_OPTIONS} the options are not supported.
+ *     <br>{@link IMAGE_DECODE_FAILED} the tile fails to be decoded.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_DecodeTile(OH_ImageSourceTileDecoder *decoder, uint32_t level,
+    Image_Region *region, OH_DecodingOptions *options, OH_PixelmapNative **pixelmap);
+
+/**
+ * @brief Decodes a tile of a progressive JPEG or interlaced PNG image pass by pass.
+ * The callback is invoked synchronously each time a pass has been applied to the tile, so a coarse preview can be
+ * displayed before the tile is fully decoded. For images without progressive passes, the callback is invoked once.
+ *
+ * @param decoder Pointer to an OH_ImageSourceTileDecoder object.
+ * @param level Scale level, in the range [0, levelCount).
+ * @param region Pointer to the tile region, in the coordinates of the image at the scale level.
+ * @param callback Callback invoked when a pass is decoded, see {@link OH_ImageSourceTileDecoder_OnPassDecoded}.
+ * @param userData Pointer to user specific data.
+ * @param pixelmap Double pointer to the OH_PixelmapNative object created, which holds the fully decoded tile.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} decoder, region, callback or pixelmap is nullptr, or level is out of
+ *     range.
+ *     <br>{@link IMAGE_INVALID_REGION} the region is out of the image at the scale level.
+ *     <br>{@link IMAGE_DECODE_FAILED} the tile fails to be decoded.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_DecodeTileProgressive(OH_ImageSourceTileDecoder *decoder, uint32_t level,
+    Image_Region *region, OH_ImageSourceTileDecoder_OnPassDecoded callback, void *userData,
+    OH_PixelmapNative **pixelmap);
+
+/**
+ * @brief Releases a tile decoder and the parsed stream state it holds.
+ * The tile pixelmaps created by the tile decoder are not released.
+ *
+ * @param decoder Pointer to an OH_ImageSourceTileDecoder object.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} decoder is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_Release(OH_ImageSourceTileDecoder *decoder);
+
+/**
+ * @brief Defines the options for batch thumbnail generation.
+ * It is created by calling {@link OH_ThumbnailOptions_Create}.
+ *
+ * @since 26.1.0
+ */
+struct OH_ThumbnailOptions;
+
+/**
+ * @brief Defines the options for batch thumbnail generation.
+ * It is created by calling {@link OH_ThumbnailOptions_Create}.
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_ThumbnailOptions OH_ThumbnailOptions;
+
+/**
+ * @brief Defines a callback invoked when a thumbnail of a batch is generated.
+ * The callback is invoked on a worker thread, and the thumbnails may be delivered in any order.
+ * Calls are not serialized: when the maximum concurrency is greater than 1, the callback may run concurrently on
+ * several worker threads, so access to <b>userData</b> must be synchronized by the application. A worker thread
+ * starts its next image only after the callback returns, so a slow callback also slows down the batch.
+ *
+ * @param index Index of the image in the input array.
+ * @param errorCode Result of the thumbnail generation. {@link IMAGE_SUCCESS} if the execution is successful.
+ * @param pixelmap Pointer to the thumbnail. It is nullptr if the generation fails. The ownership of the thumbnail is
+ *     transferred to the application, which must call {@link OH_PixelmapNative_Release} when it is no longer used.
+ * @param userData Pointer to user specific data.
+ * @since 26.1.0
+ */
+typedef void (*OH_ImageSourceNative_OnThumbnailCreated)(uint32_t index, Image_ErrorCode errorCode,
+    OH_PixelmapNative *pixelmap, void *userData);
+
+/**
+ * @brief Creates the pointer to an OH_ThumbnailOptions object.
+ *
+ * @param options Double pointer to the OH_ThumbnailOptions object created.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} options is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_Create(OH_ThumbnailOptions **options);
+
+/**
+ * @brief Sets the desired thumbnail size.
+ * The thumbnail keeps the aspect ratio of the source image and fits within the desired size. This option is mandatory.
+ *
+ * @param options Pointer to an OH_ThumbnailOptions object.
+ * @param desiredSize Pointer to the desired thumbnail size.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} options or desiredSize is nullptr, or desiredSize is empty.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_SetDesiredSize(OH_ThumbnailOptions *options, Image_Size *desiredSize);
+
+/**
+ * @brief Sets whether to use the thumbnail embedded in the image, for example the EXIF thumbnail of a JPEG image.
+ * The embedded thumbnail is used only if it is not smaller than the desired size. Otherwise, the image is decoded
+ * with the downscaling provided by the codec, for example DCT-domain downscaling of JPEG images.
+ *
+ * @param options Pointer to an OH_ThumbnailOptions object.
+ * @param preferEmbedded Whether to use the embedded thumbnail. The default value is true.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} options is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_SetPreferEmbeddedThumbnail(OH_ThumbnailOptions *options, bool preferEmbedded);
+
+/**
+ * @brief Sets the maximum number of images decoded at the same time in a batch.
+ * It bounds the memory used by a batch. The default value is decided by the system based on the number of CPU cores.
+ * The bound covers the decoding working memory of the images being processed. Thumbnails already delivered through
+ * {@link OH_ImageSourceNative_OnThumbnailCreated} belong to the application and are not counted, so the memory used
+ * stays bounded only if the application releases or hands off the thumbnails it does not need.
+ *
+ * @param options Pointer to an OH_ThumbnailOptions object.
+ * @param maxConcurrency Maximum number of images decoded at the same time. The value must be greater than 0.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} options is nullptr, or maxConcurrency is 0.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_SetMaxConcurrency(OH_ThumbnailOptions *options, uint32_t maxConcurrency);
+
+/**
+ * @brief Releases an OH_ThumbnailOptions object.
+ *
+ * @param options Pointer to an OH_ThumbnailOptions object.
+ * @return {@link IMAGE_SUCCESS} if the execution is successful.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} options is nullptr.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_Release(OH_ThumbnailOptions *options);
+
+/**
+ * @brief Generates thumbnails for a batch of images specified by URIs.
+ * The images are decoded on a worker pool, and each thumbnail is delivered through the callback as soon as it is
+ * generated. This function returns after the callback has been invoked for every image. A failure of one image does
+ * not stop the batch.
+ *
+ * @param uris Array of the URIs of the images. The URI format is the same as in
+ *     {@link OH_ImageSourceNative_CreateFromUri}.
+ * @param uriSizes Array of the lengths of the URIs.
+ * @param count Number of images in the batch.
+ * @param options Pointer to an OH_ThumbnailOptions object.
+ * @param callback Callback invoked when a thumbnail is generated, see {@link OH_ImageSourceNative_OnThumbnailCreated}.
+ * @param userData Pointer to user specific data.
+ * @return {@link IMAGE_SUCCESS} if the batch is processed.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} uris, uriSizes, options or callback is nullptr, count is 0, or the
+ *     desired size is not set.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceNative_CreateThumbnailsFromUris(char *uris[], size_t uriSizes[], size_t count,
+    OH_ThumbnailOptions *options, OH_ImageSourceNative_OnThumbnailCreated callback, void *userData);
+
+/**
+ * @brief Generates thumbnails for a batch of images specified by file descriptors.
+ * The images are decoded on a worker pool, and each thumbnail is delivered through the callback as soon as it is
+ * generated. This function returns after the callback has been invoked for every image. A failure of one image does
+ * not stop the batch. The file descriptors are not closed.
+ *
+ * @param fds Array of the file descriptors of the images.
+ * @param count Number of images in the batch.
+ * @param options Pointer to an OH_ThumbnailOptions object.
+ * @param callback Callback invoked when a thumbnail is generated, see {@link OH_ImageSourceNative_OnThumbnailCreated}.
+ * @param userData Pointer to user specific data.
+ * @return {@link IMAGE_SUCCESS} if the batch is processed.
+ *     <br>{@link IMAGE_SOURCE_INVALID_PARAMETER} fds, options or callback is nullptr, count is 0, or the desired size
+ *     is not set.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceNative_CreateThumbnailsFromFds(int32_t fds[], size_t count,
+    OH_ThumbnailOptions *options, OH_ImageSourceNative_OnThumbnailCreated callback, void *userData);
+
 #ifdef __cplusplus
 };
 #endif
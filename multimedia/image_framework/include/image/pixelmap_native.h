@@ -1520,6 +1520,89 @@ Image_ErrorCode OH_PixelmapNative_GetUniqueId(OH_PixelmapNative *pixelmap, uint3
  */
 Image_ErrorCode OH_PixelmapNative_IsReleased(OH_PixelmapNative *pixelmap, bool *released);
 
+/**
+ * @brief Defines a pixel buffer used by the pixel conversion functions.
+ * For the YUV formats {@link PIXEL_FORMAT_NV21} and {@link PIXEL_FORMAT_NV12}, the chroma plane immediately follows
+ * the luma plane and uses the same row stride.
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_Pixelmap_PixelBuffer {
+    /** Pixel data. */
+    uint8_t *pixels;
+    /** Length of the pixel data, in bytes. */
+    size_t pixelsSize;
+    /** Width of the image, in pixels. */
+    uint32_t width;
+    /** Height of the image, in pixels. */
+    uint32_t height;
+    /** Number of bytes per row. If the value is 0, the rows are tightly packed. */
+    uint32_t rowStride;
+    /** Pixel format, see {@link PIXEL_FORMAT}. */
+    PIXEL_FORMAT format;
+} OH_Pixelmap_PixelBuffer;
+
+/**
+ * @brief Converts the pixel format of a pixel buffer and resizes it into another pixel buffer in one pass.
+ * The source and destination buffers must not overlap. If the destination size differs from the source size, the
+ * pixels are resampled with the given filter. The conversion uses the vector instructions of the device when
+ * available, and the result does not depend on whether they are used.
+ *
+ * @param src Pointer to the source pixel buffer.
+ * @param dst Pointer to the destination pixel buffer, which is allocated by the caller.
+ * @param level The filter used for resizing, see {@link OH_PixelmapNative_AntiAliasingLevel}.
+ * @return Function result code:
+ *         {@link IMAGE_SUCCESS} If the operation is successful.
+ *         {@link IMAGE_INVALID_PARAMETER} If src or dst is nullptr, a buffer is too small for its size and stride, or
+ *             the buffers overlap.
+ *         {@link IMAGE_UNSUPPORTED_CONVERSION} If the conversion between the two pixel formats is not supported.
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PixelmapNative_ConvertPixels(const OH_Pixelmap_PixelBuffer *src, OH_Pixelmap_PixelBuffer *dst,
+    OH_PixelmapNative_AntiAliasingLevel level);
+
+/**
+ * @brief Converts a region of a PixelMap to the pixel format and size of a caller-provided pixel buffer.
+ * The PixelMap is not modified.
+ *
+ * @param pixelmap Pointer to the source PixelMap.
+ * @param region Pointer to the source region. If it is nullptr, the whole PixelMap is converted.
+ * @param dst Pointer to the destination pixel buffer, which is allocated by the caller.
+ * @param level The filter used for resizing, see {@link OH_PixelmapNative_AntiAliasingLevel}.
+ * @return Function result code:
+ *         {@link IMAGE_SUCCESS} If the operation is successful.
+ *         {@link IMAGE_INVALID_PARAMETER} If pixelmap or dst is nullptr, or dst is too small for its size and stride.
+ *         {@link IMAGE_INVALID_REGION} If the region is out of the PixelMap.
+ *         {@link IMAGE_PIXELMAP_RELEASED} If the PixelMap has been released.
+ *         {@link IMAGE_UNSUPPORTED_CONVERSION} If the conversion between the two pixel formats is not supported.
+ * @see OH_PixelmapNative
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PixelmapNative_ConvertToBuffer(OH_PixelmapNative *pixelmap, Image_Region *region,
+    OH_Pixelmap_PixelBuffer *dst, OH_PixelmapNative_AntiAliasingLevel level);
+
+/**
+ * @brief Converts a region of a PixelMap to the pixel format and size of an OH_NativeBuffer.
+ * The destination format, size and stride are taken from the configuration of the OH_NativeBuffer. The PixelMap is
+ * not modified.
+ *
+ * @param pixelmap Pointer to the source PixelMap.
+ * @param region Pointer to the source region. If it is nullptr, the whole PixelMap is converted.
+ * @param nativeBuffer Pointer to the destination OH_NativeBuffer.
+ * @param level The filter used for resizing, see {@link OH_PixelmapNative_AntiAliasingLevel}.
+ * @return Function result code:
+ *         {@link IMAGE_SUCCESS} If the operation is successful.
+ *         {@link IMAGE_INVALID_PARAMETER} If pixelmap or nativeBuffer is nullptr.
+ *         {@link IMAGE_INVALID_REGION} If the region is out of the PixelMap.
+ *         {@link IMAGE_PIXELMAP_RELEASED} If the PixelMap has been released.
+ *         {@link IMAGE_UNSUPPORTED_CONVERSION} If the format of the OH_NativeBuffer is not supported.
+ *         {@link IMAGE_LOCK_UNLOCK_FAILED} If the OH_NativeBuffer fails to be mapped.
+ * @see OH_PixelmapNative
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PixelmapNative_ConvertToNativeBuffer(OH_PixelmapNative *pixelmap, Image_Region *region,
+    OH_NativeBuffer *nativeBuffer, OH_PixelmapNative_AntiAliasingLevel level);
+
 #ifdef __cplusplus
 };
 #endif
@@ -341,6 +341,56 @@ OH_AVErrCode OH_AVTranscoder_SetProgressUpdateCallback(
  */
 OH_AVErrCode OH_AVTranscoderConfig_EnableBFrame(OH_AVTranscoder_Config *config, bool enabled);
 
+/**
+ * @brief Sets the maximum number of segments that are transcoded in parallel.
+ * If the value is greater than 1, the source video is split at key frame (GOP) boundaries, each segment is decoded
+ * and encoded by its own codec pair concurrently, and the encoded segments are written to the output file in order
+ * with continuous timestamps. The actual number of segments may be smaller than the value set, depending on the
+ * source duration, the key frame interval and the available codec instances.
+ * If this function is not called, or the value is 1, the source video is transcoded serially.
+ * This function must be called before {@link OH_AVTranscoder_Prepare}.
+ *
+ * @param config Pointer to an OH_AVTranscoder_Config instance
+ * @param segmentCount Maximum number of segments transcoded in parallel. The value must be greater than 0.
+ * @return {@link AV_ERR_OK}: The setting is successful.
+ * {@link AV_ERR_INVALID_VAL}: The input parameter **config** is nullptr, or the value of **segmentCount** is invalid.
+ * @since 26.1.0
+ */
+OH_AVErrCode OH_AVTranscoderConfig_SetParallelSegmentCount(OH_AVTranscoder_Config *config, int32_t segmentCount);
+
+/**
+ * @brief Sets the minimum duration of a segment for parallel segmented transcoding.
+ * Segments are cut only at key frames, so the actual duration of a segment is not less than this value, except for
+ * the last segment. A larger value reduces the splitting and stitching overhead for short sources.
+ * This function takes effect only when {@link OH_AVTranscoderConfig_SetParallelSegmentCount} is set to a value greater
+ * than 1, and must be called before {@link OH_AVTranscoder_Prepare}.
+ *
+ * @param config Pointer to an OH_AVTranscoder_Config instance
+ * @param durationMs Minimum segment duration, in milliseconds. The value must be greater than 0.
+ * @return {@link AV_ERR_OK}: The setting is successful.
+ * {@link AV_ERR_INVALID_VAL}: The input parameter **config** is nullptr, or the value of **durationMs** is invalid.
+ * @since 26.1.0
+ */
+OH_AVErrCode OH_AVTranscoderConfig_SetMinSegmentDuration(OH_AVTranscoder_Config *config, int64_t durationMs);
+
+/**
+ * @brief Registers a callback for segment progress update events of parallel segmented transcoding.
+ * This callback is invoked when the progress of a transcoding segment is updated. It is not invoked if the source
+ * video is transcoded serially.
+ * An application can subscribe to only one segment progress update event. When the application initiates multiple
+ * subscriptions to this event, the last subscription is applied.
+ * The callback must be registered before {@link OH_AVTranscoder_Prepare} is called.
+ *
+ * @param transcoder Pointer to an OH_AVTranscoder instance
+ * @param callback Segment progress callback function, see {@link OH_AVTranscoder_OnSegmentProgressUpdate}
+ * @param userData Pointer to user specific data
+ * @return {@link AV_ERR_OK}: The registration is successful.
+ * {@link AV_ERR_INVALID_VAL}: The input parameter **transcoder** or **callback** is nullptr.
+ * @since 26.1.0
+ */
+OH_AVErrCode OH_AVTranscoder_SetSegmentProgressUpdateCallback(
+    OH_AVTranscoder *transcoder, OH_AVTranscoder_OnSegmentProgressUpdate callback, void *userData);
+
 #ifdef __cplusplus
 }
 #endif
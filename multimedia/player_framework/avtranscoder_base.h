@@ -121,6 +121,22 @@ typedef void (*OH_AVTranscoder_OnError)(OH_AVTranscoder *transcoder, int32_t err
  */
 typedef void (*OH_AVTranscoder_OnProgressUpdate)(OH_AVTranscoder *transcoder, int32_t progress, void *userData);
 
+/**
+ * @brief Defines a callback invoked when the progress of a transcoding segment is updated.
+ * When parallel segmented transcoding is enabled through {@link OH_AVTranscoderConfig_SetParallelSegmentCount}, the
+ * source is split at key frame (GOP) boundaries and each segment is transcoded independently. This callback reports
+ * the progress of every segment, while {@link OH_AVTranscoder_OnProgressUpdate} keeps reporting the overall progress.
+ *
+ * @param transcoder Pointer to an OH_AVTranscoder instance.
+ * @param segmentIndex Index of the segment, starting from 0.
+ * @param segmentCount Total number of segments the source is split into.
+ * @param progress Transcoding progress of the segment, in percentage.
+ * @param userData Pointer to user specific data.
+ * @since 26.1.0
+ */
+typedef void (*OH_AVTranscoder_OnSegmentProgressUpdate)(OH_AVTranscoder *transcoder, int32_t segmentIndex,
+    int32_t segmentCount, int32_t progress, void *userData);
+
 #ifdef __cplusplus
 }
 #endif
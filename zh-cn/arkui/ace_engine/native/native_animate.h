@@ -43,6 +43,7 @@
 #endif
 
 #include "native_type.h"
+#include "native_render.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -1256,6 +1257,166 @@ int32_t OH_ArkUI_TransitionEffect_Combine(
  */
 int32_t OH_ArkUI_TransitionEffect_SetAnimation(
     ArkUI_TransitionEffect* effect, ArkUI_AnimateOption* animation);
+
+/**
+ * @brief 定义由渲染服务计算的动画句柄。
+ *
+ * 与{@link ArkUI_NativeAnimateAPI_1}.animateTo不同，该类动画的每一帧在渲染服务中计算，UI线程繁忙时不会导致动画丢帧。
+ *
+ * @since 26.1.0
+ */
+typedef struct ArkUI_RenderServiceAnimation* ArkUI_RenderServiceAnimationHandle;
+
+/**
+ * @brief 定义可由渲染服务执行动画的渲染节点属性。
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** 不透明度。需要1个终点值，取值范围为[0.0, 1.0]。 */
+    ARKUI_RENDER_SERVICE_ANIMATION_PROPERTY_OPACITY = 0,
+    /** 平移。需要2个终点值：x和y，单位为px。 */
+    ARKUI_RENDER_SERVICE_ANIMATION_PROPERTY_TRANSLATION,
+    /** 缩放。需要2个终点值：x轴和y轴的缩放系数。 */
+    ARKUI_RENDER_SERVICE_ANIMATION_PROPERTY_SCALE,
+    /** 旋转。需要3个终点值：绕x轴、y轴和z轴的旋转角度，单位为度。 */
+    ARKUI_RENDER_SERVICE_ANIMATION_PROPERTY_ROTATION,
+} ArkUI_RenderServiceAnimationProperty;
+
+/**
+ * @brief 定义由渲染服务计算的动画结束时的回调函数。
+ *
+ * 回调在UI线程执行。动画正常结束时，回调执行前UI侧的属性值已更新为终点值。
+ *
+ * @param animation 已结束的动画。
+ * @param isCancelled 动画是否因调用{@link OH_ArkUI_RenderServiceAnimation_Cancel}而结束。
+ * @param userData 注册时传入的自定义数据。
+ * @since 26.1.0
+ */
+typedef void (*ArkUI_RenderServiceAnimation_OnFinishCallback)(
+    ArkUI_RenderServiceAnimationHandle animation, bool isCancelled, void* userData);
+
+/**
+ * @brief 为渲染节点的属性创建由渲染服务计算的动画。
+ *
+ * @note 仅支持无需回调应用即可计算的曲线，{@link OH_ArkUI_Curve_CreateCustomCurve}创建的自定义曲线会被拒绝。
+ * @param node 目标渲染节点。
+ * @param property 需要执行动画的属性。
+ * @param endValues 终点值数组，元素个数由<b>property</b>决定。
+ * @param size <b>endValues</b>的元素个数。
+ * @param option 动画参数，包括时长、曲线、延时、播放次数和播放模式。
+ * @param animation 创建的动画指针，作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_CreateForRenderNode(ArkUI_RenderNodeHandle node,
+    ArkUI_RenderServiceAnimationProperty property, const float* endValues, int32_t size,
+    ArkUI_AnimateOption* option, ArkUI_RenderServiceAnimationHandle* animation);
+
+/**
+ * @brief 为float类型的可动画属性创建由渲染服务计算的动画。
+ *
+ * @note 曲线限制与{@link OH_ArkUI_RenderServiceAnimation_CreateForRenderNode}相同。
+ * @param property float类型的可动画属性。
+ * @param endValue 属性的终点值。
+ * @param option 动画参数。
+ * @param animation 创建的动画指针，作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_CreateForFloatProperty(
+    ArkUI_FloatAnimatablePropertyHandle property, float endValue, ArkUI_AnimateOption* option,
+    ArkUI_RenderServiceAnimationHandle* animation);
+
+/**
+ * @brief 为二维向量类型的可动画属性创建由渲染服务计算的动画。
+ *
+ * @note 曲线限制与{@link OH_ArkUI_RenderServiceAnimation_CreateForRenderNode}相同。
+ * @param property 二维向量类型的可动画属性。
+ * @param endX x分量的终点值。
+ * @param endY y分量的终点值。
+ * @param option 动画参数。
+ * @param animation 创建的动画指针，作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_CreateForVector2Property(
+    ArkUI_Vector2AnimatablePropertyHandle property, float endX, float endY, ArkUI_AnimateOption* option,
+    ArkUI_RenderServiceAnimationHandle* animation);
+
+/**
+ * @brief 启动由渲染服务计算的动画，动画从属性的当前值开始。
+ *
+ * @param animation 目标动画。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_Start(ArkUI_RenderServiceAnimationHandle animation);
+
+/**
+ * @brief 取消正在运行的由渲染服务计算的动画，属性保持最后一帧显示的值。
+ *
+ * @param animation 目标动画。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_Cancel(ArkUI_RenderServiceAnimationHandle animation);
+
+/**
+ * @brief 注册由渲染服务计算的动画结束时的回调函数。
+ *
+ * @param animation 目标动画。
+ * @param userData 传递给回调的自定义数据。
+ * @param callback 需要注册的回调函数，传入<b>NULL</b>表示取消注册。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_RegisterOnFinishCallback(
+    ArkUI_RenderServiceAnimationHandle animation, void* userData,
+    ArkUI_RenderServiceAnimation_OnFinishCallback callback);
+
+/**
+ * @brief 获取渲染服务计算动画期间丢弃的帧数。
+ *
+ * @param animation 目标动画。
+ * @param count 丢帧数的指针，作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderServiceAnimation_GetDroppedFrameCount(
+    ArkUI_RenderServiceAnimationHandle animation, uint32_t* count);
+
+/**
+ * @brief 销毁由渲染服务计算的动画。
+ *
+ * 正在运行的动画会先被取消。已注册的结束回调会在该接口返回前同步执行，<b>isCancelled</b>为true，
+ * 以便在回调中释放注册时传入的自定义数据。若动画已经结束，则不会再次执行回调。
+ *
+ * @param animation 目标动画。
+ * @since 26.1.0
+ */
+void OH_ArkUI_RenderServiceAnimation_Dispose(ArkUI_RenderServiceAnimationHandle animation);
 #ifdef __cplusplus
 };
 #endif
@@ -1461,6 +1461,55 @@ void OH_ArkUI_XComponentSurfaceConfig_Dispose(ArkUI_XComponentSurfaceConfig* con
  */
 void OH_ArkUI_XComponentSurfaceConfig_SetIsOpaque(ArkUI_XComponentSurfaceConfig* config, bool isOpaque);
 
+/**
+ * @brief 定义XComponent组件持有的Surface送显缓冲区的模式。
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** 按缓冲区提交的顺序依次送显。生产者领先于显示且队列已满时会阻塞。 */
+    ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_FIFO = 0,
+    /** 仅送显最新提交的缓冲区，队列中较早的缓冲区不显示直接释放，生产者不会因队列已满而阻塞。 */
+    ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_MAILBOX = 1,
+} ArkUI_XComponentSurfacePresentMode;
+
+/**
+ * @brief 设置XComponent组件持有的Surface的缓冲区队列大小。
+ *
+ * 该设置在Surface创建时生效，需在Surface创建前设置。
+ *
+ * @param config 表示指向{@link ArkUI_XComponentSurfaceConfig}实例的指针。
+ * @param queueSize 表示队列中缓冲区的数量，取值范围为[1, 5]。
+ *                  默认值为3，超出取值范围时使用默认值。
+ *                  在{@link ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_MAILBOX}模式下，队列大小为1时按2处理。
+ * @since 26.1.0
+ */
+void OH_ArkUI_XComponentSurfaceConfig_SetBufferQueueSize(ArkUI_XComponentSurfaceConfig* config, uint32_t queueSize);
+
+/**
+ * @brief 设置是否在XComponent组件持有的Surface创建时分配队列中的全部缓冲区，使Surface显示后的首帧无需等待缓冲区分配。
+ *
+ * @param config 表示指向{@link ArkUI_XComponentSurfaceConfig}实例的指针。
+ * @param preallocate 表示是否预分配缓冲区。
+ *                    true表示在Surface创建时按Surface的尺寸和格式分配缓冲区，false表示在首次申请时分配缓冲区，
+ *                    默认值为false。
+ *                    若之后通过<b>OH_NativeWindow_NativeWindowHandleOpt</b>修改buffer的尺寸、格式或用途，
+ *                    预分配的buffer会被丢弃，申请时按新的设置重新分配。
+ * @since 26.1.0
+ */
+void OH_ArkUI_XComponentSurfaceConfig_SetPreallocateBuffers(ArkUI_XComponentSurfaceConfig* config, bool preallocate);
+
+/**
+ * @brief 设置XComponent组件持有的Surface的送显模式。
+ *
+ * @param config 表示指向{@link ArkUI_XComponentSurfaceConfig}实例的指针。
+ * @param mode 表示送显模式，默认值为{@link ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_FIFO}。
+ *             {@link ARKUI_XCOMPONENT_SURFACE_PRESENT_MODE_MAILBOX}至少需要2个buffer，缓冲区队列大小设置为1时使用2个buffer。
+ * @since 26.1.0
+ */
+void OH_ArkUI_XComponentSurfaceConfig_SetPresentMode(
+    ArkUI_XComponentSurfaceConfig* config, ArkUI_XComponentSurfacePresentMode mode);
+
 /**
  * @brief 为{@link OH_ArkUI_SurfaceHolder}实例设置Surface配置。
  *
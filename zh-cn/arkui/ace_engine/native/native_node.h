@@ -16087,6 +16087,390 @@ ArkUI_ErrorCode OH_ArkUI_NativeModule_SetChildMountPolicy(ArkUI_NodeHandle node,
  */
 ArkUI_ErrorCode OH_ArkUI_NativeModule_GetChildMountPolicy(ArkUI_NodeHandle node, OH_ArkUI_NodeMountPolicy* policy);
 
+/**
+ * @brief 定义属性条目，用于一次设置节点的多个属性。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** 属性类型。 */
+    ArkUI_NodeAttributeType attribute;
+    /** 指向属性值的指针。 */
+    const ArkUI_AttributeItem* item;
+} ArkUI_NodeAttributeEntry;
+
+/**
+ * @brief 一次设置节点的多个属性。
+ *        应用前先校验所有条目，任一条目无效时不设置任何属性。
+ *        与逐个调用{@link setAttribute}相比，整批属性只标脏一次，并只进行一次测算和布局。
+ *
+ * @param node 目标节点。
+ * @param entries 属性条目数组的指针。同一属性出现多次时，最后一个条目生效。
+ * @param count 数组中的条目数量。
+ * @param failedIndex 操作失败时，第一个无效条目的索引。可以传入空指针。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_ATTRIBUTE_OR_EVENT_NOT_SUPPORTED} 节点不支持某个属性。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_SetAttributes(ArkUI_NodeHandle node, const ArkUI_NodeAttributeEntry* entries,
+    uint32_t count, uint32_t* failedIndex);
+
+/**
+ * @brief 创建节点样式。
+ *
+ * @return 返回创建的节点样式的指针。内存分配失败时返回空指针。
+ * @since 26.1.0
+ */
+ArkUI_NodeStyle* OH_ArkUI_NodeStyle_Create(void);
+
+/**
+ * @brief 销毁节点样式。已应用该样式的节点不受影响。
+ *
+ * @param style 节点样式的指针。
+ * @since 26.1.0
+ */
+void OH_ArkUI_NodeStyle_Dispose(ArkUI_NodeStyle* style);
+
+/**
+ * @brief 向节点样式中添加属性。属性值会被拷贝到样式中并只校验一次，每次应用样式时不再重复校验。
+ *        修改样式不会影响已应用该样式的节点。
+ *
+ * @param style 节点样式的指针。
+ * @param attribute 属性类型。
+ * @param item 指向属性值的指针。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NodeStyle_SetAttribute(ArkUI_NodeStyle* style, ArkUI_NodeAttributeType attribute,
+    const ArkUI_AttributeItem* item);
+
+/**
+ * @brief 将节点样式应用到节点上。样式中的所有属性通过一次调用设置到节点上，只标脏一次，并只进行一次测算和布局。
+ *        样式中未包含的属性保持原值。
+ *
+ * @param node 目标节点。
+ * @param style 节点样式的指针。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_ATTRIBUTE_OR_EVENT_NOT_SUPPORTED} 节点不支持样式中的某个属性。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_ApplyStyle(ArkUI_NodeHandle node, const ArkUI_NodeStyle* style);
+
+/**
+ * @brief 定义组件适配器回收池中某一复用类型的统计信息。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** 从回收池中取到节点的请求次数。 */
+    uint64_t hitCount;
+    /** 回收池为空、未取到节点的请求次数。 */
+    uint64_t missCount;
+    /** 回收池中当前保存的节点数量。 */
+    uint32_t pooledCount;
+} ArkUI_NodeAdapterRecycleStats;
+
+/**
+ * @brief 定义为组件适配器回收池预先创建节点的回调函数。
+ *
+ * @param handle 组件适配器。
+ * @param reuseType 待创建节点的复用类型。
+ * @param userData 注册回调时传入的自定义数据。
+ * @return 返回创建的节点。返回空指针时停止预创建。
+ * @since 26.1.0
+ */
+typedef ArkUI_NodeHandle (*ArkUI_NodeAdapter_CreateRecycledNodeCallback)(ArkUI_NodeAdapterHandle handle,
+    int32_t reuseType, void* userData);
+
+/**
+ * @brief 设置组件适配器回收池中某一复用类型可保存的最大节点数量。
+ *        通过{@link OH_ArkUI_NodeAdapterEvent_SetItemWithReuseType}添加的节点从适配器中移除时，若该复用类型的回收池未满，
+ *        节点会被卸载但保持存活并存入回收池，不会为其发送NODE_ADAPTER_EVENT_ON_REMOVE_NODE_FROM_ADAPTER事件。默认容量为0，不保存任何节点。
+ *        新容量小于回收池中的节点数量时，多余的节点被移出回收池，并逐个发送NODE_ADAPTER_EVENT_ON_REMOVE_NODE_FROM_ADAPTER事件。
+ *        通过<b>OH_ArkUI_NodeAdapter_Dispose</b>销毁适配器时，回收池中的所有节点会被移出，并在适配器释放前逐个发送
+ *        NODE_ADAPTER_EVENT_ON_REMOVE_NODE_FROM_ADAPTER事件，确保应用始终能够销毁回收池中的节点。
+ *
+ * @param handle 组件适配器。
+ * @param reuseType 应用自定义的复用类型。
+ * @param capacity 该复用类型可保存的最大节点数量。
+ * @return 错误码。
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapter_SetRecyclePoolCapacity(ArkUI_NodeAdapterHandle handle, int32_t reuseType,
+    uint32_t capacity);
+
+/**
+ * @brief 在空闲帧中为组件适配器的回收池创建某一复用类型的节点。
+ *        当帧有剩余时间时，在UI线程调用回调函数，直到回收池中该复用类型的节点数量达到count或回收池已满。
+ *
+ * @param handle 组件适配器。
+ * @param reuseType 待创建节点的复用类型。
+ * @param count 回收池中需要达到的节点数量。
+ * @param callback 创建节点的回调函数。
+ * @param userData 传给回调函数的自定义数据。
+ * @return 错误码。
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapter_PrecreateRecycledNodes(ArkUI_NodeAdapterHandle handle, int32_t reuseType,
+    uint32_t count, ArkUI_NodeAdapter_CreateRecycledNodeCallback callback, void* userData);
+
+/**
+ * @brief 移出组件适配器回收池中的所有节点，并逐个发送NODE_ADAPTER_EVENT_ON_REMOVE_NODE_FROM_ADAPTER事件，以便销毁这些节点。
+ *        销毁适配器时，回收池中的节点同样如此处理。
+ *
+ * @param handle 组件适配器。
+ * @return 错误码。
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapter_ClearRecyclePool(ArkUI_NodeAdapterHandle handle);
+
+/**
+ * @brief 获取组件适配器回收池中某一复用类型的统计信息。
+ *
+ * @param handle 组件适配器。
+ * @param reuseType 复用类型。
+ * @param stats 统计信息的指针，作为出参使用。
+ * @return 错误码。
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapter_GetRecyclePoolStats(ArkUI_NodeAdapterHandle handle, int32_t reuseType,
+    ArkUI_NodeAdapterRecycleStats* stats);
+
+/**
+ * @brief 从事件所属组件适配器的回收池中取出一个某一复用类型的节点。
+ *        在处理NODE_ADAPTER_EVENT_ON_ADD_NODE_TO_ADAPTER事件时调用，按新的索引更新返回节点的属性后，
+ *        传入{@link OH_ArkUI_NodeAdapterEvent_SetItemWithReuseType}。
+ *
+ * @param event 适配器事件对象。
+ * @param reuseType 节点的复用类型。
+ * @param node 从回收池中取出的节点，作为出参使用。该复用类型的回收池为空时设置为空指针。
+ * @return 错误码。
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapterEvent_DequeueRecycledNode(ArkUI_NodeAdapterEvent* event, int32_t reuseType,
+    ArkUI_NodeHandle* node);
+
+/**
+ * @brief 设置需要新增到适配器中的组件，以及该组件从适配器中移除时用于回收的复用类型。
+ *
+ * @param event 适配器事件对象。
+ * @param node 待添加的组件。
+ * @param reuseType 应用自定义的复用类型。
+ * @return 错误码。
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_NodeAdapterEvent_SetItemWithReuseType(ArkUI_NodeAdapterEvent* event, ArkUI_NodeHandle node,
+    int32_t reuseType);
+
+/**
+ * @brief 为UI实例创建离线构建器。可在任意线程调用。
+ *
+ * @param context UI实例对象指针。
+ * @param builder 创建的离线构建器的指针，作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_UI_CONTEXT_INVALID} UI实例无效。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_Create(ArkUI_ContextHandle context, ArkUI_DetachedBuilder** builder);
+
+/**
+ * @brief 销毁离线构建器。该接口可在任意线程调用。
+ * 在构建器中创建且尚未提交的节点会随构建器一并销毁，其句柄随之失效；已提交的节点不受影响。
+ * 若构建器绑定在当前线程，会先按调用{@link OH_ArkUI_DetachedBuilder_Leave}的方式解除绑定；
+ * 若构建器绑定在其他线程，本次调用被忽略，构建器仍然有效。
+ *
+ * @param builder 离线构建器的指针。
+ * @since 26.1.0
+ */
+void OH_ArkUI_DetachedBuilder_Dispose(ArkUI_DetachedBuilder* builder);
+
+/**
+ * @brief 将离线构建器绑定到当前线程。
+ *        在调用{@link OH_ArkUI_DetachedBuilder_Leave}之前，当前线程创建的节点归属于该构建器，
+ *        可在当前线程对这些节点调用{@link ArkUI_NativeNodeAPI_1}中创建节点、设置和重置属性、添加和移除子节点的接口。
+ *        对不是在该构建器中创建的节点调用这些接口时，返回{@link ARKUI_ERROR_CODE_NODE_ON_INVALID_THREAD}。
+ *        同一时间一个构建器只能绑定到一个线程。
+ *
+ * @param builder 离线构建器的指针。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常，或者构建器已绑定到其他线程或已提交。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_Enter(ArkUI_DetachedBuilder* builder);
+
+/**
+ * @brief 解除离线构建器与当前线程的绑定。之后可将构建器绑定到其他线程或提交。
+ *
+ * @param builder 离线构建器的指针。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常，或者构建器未绑定到当前线程。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_Leave(ArkUI_DetachedBuilder* builder);
+
+/**
+ * @brief 设置离线构建器中构建的子树的根节点。该节点必须在该构建器中创建。
+ *
+ * @param builder 离线构建器的指针。
+ * @param root 子树的根节点。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常，或者该节点不是在该构建器中创建的。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_SetRootNode(ArkUI_DetachedBuilder* builder, ArkUI_NodeHandle root);
+
+/**
+ * @brief 在构建器绑定的线程上，按指定约束对离线构建器的子树进行测算和布局。
+ *
+ * @param builder 离线构建器的指针。
+ * @param constraint 预期子树提交后父节点给出的布局约束。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常，或者未设置根节点。
+ *     <br>{@link ARKUI_ERROR_CODE_NODE_ON_INVALID_THREAD} 构建器未绑定到当前线程。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_MeasureAndLayout(ArkUI_DetachedBuilder* builder,
+    const ArkUI_LayoutConstraint* constraint);
+
+/**
+ * @brief 通过一次操作将离线构建器的子树挂载到父节点上。必须在构建器离开其线程后于UI线程调用，耗时与子树大小无关。
+ *        若父节点给出的约束与传入{@link OH_ArkUI_DetachedBuilder_MeasureAndLayout}的约束相同，则复用布局结果，否则在下一帧重新布局。
+ *        提交后，子树中的节点成为普通节点，只能在UI线程操作。
+ *
+ * @param builder 离线构建器的指针。
+ * @param parent 父节点。
+ * @param index 子树在父节点子节点中的位置。取值为-1表示挂载到末尾。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常，未设置根节点，或者构建器仍绑定在某个线程上或已提交。
+ *     <br>{@link ARKUI_ERROR_CODE_NODE_ON_INVALID_THREAD} 未在UI线程调用。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_DetachedBuilder_Commit(ArkUI_DetachedBuilder* builder, ArkUI_NodeHandle parent,
+    int32_t index);
+
+/**
+ * @brief 定义一帧的布局统计信息。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** 该帧中进行测算的节点数量。 */
+    uint32_t measuredNodeCount;
+    /** 该帧中进行布局的节点数量。 */
+    uint32_t laidOutNodeCount;
+    /** 因可复用节点缓存的测算结果而跳过测算的次数。 */
+    uint32_t measureCacheHitCount;
+    /** 由<b>markDirty</b>传入{@link NODE_NEED_MEASURE}触发的子树重新布局次数。 */
+    uint32_t relayoutByMeasureFlagCount;
+    /** 由<b>markDirty</b>传入{@link NODE_NEED_LAYOUT}触发的子树重新布局次数。 */
+    uint32_t relayoutByLayoutFlagCount;
+    /** 由属性变化触发的子树重新布局次数。 */
+    uint32_t relayoutByAttributeCount;
+    /** 由添加或移除子节点触发的子树重新布局次数。 */
+    uint32_t relayoutByChildChangeCount;
+    /** 由父节点布局约束变化触发的子树重新布局次数。 */
+    uint32_t relayoutByConstraintCount;
+} ArkUI_LayoutFrameStats;
+
+/**
+ * @brief 注册回调函数，上报UI实例每一帧的布局统计信息。仅在注册了回调函数期间收集统计信息。
+ *
+ * @param uiContext UI实例对象指针。
+ * @param userData 传给回调函数的自定义数据。
+ * @param callback 每帧布局完成后在UI线程执行的回调函数。统计信息仅在回调期间有效。传入空指针表示注销回调并停止收集统计信息。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_UI_CONTEXT_INVALID} UI实例无效。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_RegisterLayoutStatsCallback(ArkUI_ContextHandle uiContext, void* userData,
+    void (*callback)(const ArkUI_LayoutFrameStats* stats, uint32_t frameCount, void* userData));
+
+/**
+ * @brief 设置是否固定节点的测算结果。
+ *        测算结果固定期间，只要父节点给出的布局约束不变，节点就不会重新测算；后代节点请求测算时（例如文本内容发生变化），
+ *        该请求不会传递给该节点的祖先节点，而是在该节点缓存的布局约束下重新测算并布局其子树，该节点的尺寸保持不变。
+ *        对该节点本身调用<b>markDirty</b>并传入{@link NODE_NEED_MEASURE}时，仍会重新测算。
+ *        适用于尺寸不依赖内容的节点，例如固定尺寸的列表项。
+ *
+ * @param node 目标节点。
+ * @param pinned 是否固定测算结果。true表示固定，false表示不固定。默认值为false。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_SetMeasureResultPinned(ArkUI_NodeHandle node, bool pinned);
+
+/**
+ * @brief 注册按帧接收节点合并事件的接收函数。
+ *        对于通过{@link OH_ArkUI_NativeModule_SetEventCoalescingEnabled}开启合并的事件类型，节点在一帧内收到的事件按发生顺序
+ *        以一个数组交付给该接收函数，而不是逐个交付给通过<b>registerNodeEventReceiver</b>或<b>addNodeEventReceiver</b>注册的接收函数。
+ *        相同触点的连续触摸移动事件会合并为一个事件：接收函数收到该帧的最后一个触摸移动事件，之前事件的触点保留为该事件的历史点，
+ *        可通过<b>OH_ArkUI_PointerEvent_GetHistory*</b>获取。
+ *        合并事件在该帧的同步分发完成后交付，因此<b>OH_ArkUI_PointerEvent_SetStopPropagation</b>等冒泡控制以及事件的消费状态均不生效。
+ *
+ * @param node 目标节点。
+ * @param userData 传给接收函数的自定义数据。
+ * @param receiver 节点有合并事件的每一帧在UI线程执行一次的接收函数。事件仅在回调期间有效。传入空指针表示注销接收函数。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_RegisterCoalescedEventReceiver(ArkUI_NodeHandle node, void* userData,
+    void (*receiver)(ArkUI_NodeEvent** events, uint32_t count, void* userData));
+
+/**
+ * @brief 设置是否按帧合并节点的某一事件类型。合并后的事件交付给通过{@link OH_ArkUI_NativeModule_RegisterCoalescedEventReceiver}注册的接收函数。
+ *        合并适用于{@link NODE_TOUCH_EVENT}、{@link NODE_SCROLL_EVENT_ON_SCROLL}等高频事件。
+ *        框架需要读取返回值的事件（例如通过<b>OH_ArkUI_NodeEvent_SetReturnNumberValue</b>设置返回值的事件）不能合并。
+ *        由于冒泡控制对合并事件不生效，仅在无需阻止触摸事件冒泡的节点上开启触摸事件合并。
+ *
+ * @param node 目标节点。
+ * @param eventType 事件类型，必须已通过<b>registerNodeEvent</b>在该节点上注册。
+ * @param enabled 是否合并该事件类型。true表示合并，false表示不合并。默认值为false。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_NODE_UNSUPPORTED_EVENT_TYPE} 该事件类型不支持合并。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_NativeModule_SetEventCoalescingEnabled(ArkUI_NodeHandle node, ArkUI_NodeEventType eventType,
+    bool enabled);
+
 #ifdef __cplusplus
 };
 #endif
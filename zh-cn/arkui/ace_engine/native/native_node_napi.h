@@ -387,6 +387,63 @@ ArkUI_ErrorCode OH_ArkUI_InitModuleForArkTSEnv(napi_env env);
  */
 void OH_ArkUI_NotifyArkTSEnvDestroy(napi_env env);
 
+/**
+ * @brief 注册一个在下一帧空闲时间执行的回调函数，并提供可在回调执行期间查询剩余帧预算的截止时间对象。
+ *        与只传入回调开始时剩余时间的{@link OH_ArkUI_PostIdleCallback}不同，截止时间对象可多次查询，
+ *        因此可将创建节点、测算文本、解码图片等工作拆分为小步骤，并在预算耗尽前停止。
+ *        如果当前没有下一帧，将自动请求下一帧。不能在非UI线程调用。
+ *
+ * @param uiContext UIContext对象，用以绑定实例。
+ * @param userData 自定义事件参数，当自定义回调函数触发时在回调参数中携带回来。
+ * @param callback 自定义回调函数。截止时间对象仅在回调期间有效。
+ * @param nanoTimeout 等待空闲时间的最长时间，单位为纳秒。超时后即使帧没有空闲时间也会执行回调，
+ *        此时{@link OH_ArkUI_IdleDeadline_IsTimeout}返回true。取值为0表示不限时等待。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化错误。
+ *     <br>{@link ARKUI_ERROR_CODE_UI_CONTEXT_INVALID} uiContext对象无效。
+ *     <br>{@link ARKUI_ERROR_CODE_CALLBACK_INVALID} 回调函数无效。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_PostIdleCallbackWithDeadline(ArkUI_ContextHandle uiContext, void* userData,
+    void (*callback)(ArkUI_IdleDeadline* deadline, void* userData), uint64_t nanoTimeout);
+
+/**
+ * @brief 获取当前帧预算的剩余时间。每次调用时重新计算。
+ *
+ * @param deadline 截止时间对象的指针。
+ * @param nanoTimeLeft 帧预算耗尽前的剩余时间，单位为纳秒。预算已耗尽时为0。作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} deadline或nanoTimeLeft为空指针。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_IdleDeadline_GetTimeLeft(const ArkUI_IdleDeadline* deadline, uint64_t* nanoTimeLeft);
+
+/**
+ * @brief 获取执行空闲回调的帧的帧号。
+ *
+ * @param deadline 截止时间对象的指针。
+ * @param frameCount 帧号，作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} deadline或frameCount为空指针。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_IdleDeadline_GetFrameCount(const ArkUI_IdleDeadline* deadline, uint32_t* frameCount);
+
+/**
+ * @brief 判断空闲回调是否因传入{@link OH_ArkUI_PostIdleCallbackWithDeadline}的超时时间已到而执行，而非因为帧有空闲时间。
+ *
+ * @param deadline 截止时间对象的指针。
+ * @param isTimeout 回调是否因超时而执行，作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} deadline或isTimeout为空指针。
+ * @since 26.1.0
+ */
+int32_t OH_ArkUI_IdleDeadline_IsTimeout(const ArkUI_IdleDeadline* deadline, bool* isTimeout);
+
 #ifdef __cplusplus
 };
 #endif
@@ -2148,6 +2148,61 @@ ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_GetRenderNodeChildrenCount(ArkUI_NodeHa
  */
 ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_GetRenderNodeAt(
     ArkUI_NodeHandle node, int32_t position, ArkUI_RenderNodeHandle* child);
+
+/**
+ * @brief 渲染节点的缓存提示。
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** 不缓存，每帧绘制渲染节点的子树。默认值。 */
+    ARKUI_RENDER_NODE_CACHE_HINT_NONE = 0,
+    /** 子树的绘制指令只录制一次，在子树内容变化前重复回放。 */
+    ARKUI_RENDER_NODE_CACHE_HINT_DISPLAY_LIST = 1,
+    /** 子树被光栅化到离屏图层，渲染节点只有变换和不透明度变化时复用该图层。子树的内容或尺寸变化时重新光栅化。 */
+    ARKUI_RENDER_NODE_CACHE_HINT_RASTER = 2,
+} ArkUI_RenderNodeCacheHint;
+
+/**
+ * @brief 设置渲染节点的缓存提示。适用于复杂背景等静态子树，避免在动画期间每帧重绘。
+ *        缓存提示可能被忽略，例如离屏图层将超出系统内存限制时。
+ *
+ * @param node 目标渲染节点。
+ * @param hint 缓存提示。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化失败。
+ *     <br>{@link ARKUI_ERROR_CODE_RENDER_IS_FROM_FRAME_NODE} 目标节点是从一个FrameNode获取的。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_SetCacheHint(ArkUI_RenderNodeHandle node, ArkUI_RenderNodeCacheHint hint);
+
+/**
+ * @brief 获取渲染节点的缓存提示。
+ *
+ * @param node 目标渲染节点。
+ * @param hint 缓存提示的指针，作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化失败。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_GetCacheHint(ArkUI_RenderNodeHandle node, ArkUI_RenderNodeCacheHint* hint);
+
+/**
+ * @brief 获取自设置缓存提示以来渲染节点缓存失效的次数。若该次数每帧都在增长，说明子树并非静态，缓存只会增加开销。
+ *
+ * @param node 目标渲染节点。
+ * @param count 缓存失效次数的指针，作为出参使用。
+ * @return 错误码。
+ *     <br>{@link ARKUI_ERROR_CODE_NO_ERROR} 成功。
+ *     <br>{@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ *     <br>{@link ARKUI_ERROR_CODE_CAPI_INIT_ERROR} CAPI初始化失败。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_RenderNodeUtils_GetCacheInvalidationCount(ArkUI_RenderNodeHandle node, uint32_t* count);
 #ifdef __cplusplus
 };
 #endif
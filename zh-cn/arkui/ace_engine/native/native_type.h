@@ -277,6 +277,27 @@ typedef struct ArkUI_Matrix4 ArkUI_Matrix4;
  */
 typedef struct ArkUI_SelectedDragPreviewStyle ArkUI_SelectedDragPreviewStyle;
 
+/**
+ * @brief 定义节点样式，即可通过一次调用应用到节点上的预构建属性集合。
+ *
+ * @since 26.1.0
+ */
+typedef struct ArkUI_NodeStyle ArkUI_NodeStyle;
+
+/**
+ * @brief 定义离线构建器，可在非UI线程中构建组件子树并完成布局，再通过一次操作挂载到组件树上。
+ *
+ * @since 26.1.0
+ */
+typedef struct ArkUI_DetachedBuilder ArkUI_DetachedBuilder;
+
+/**
+ * @brief 定义空闲回调的截止时间对象，用于跟踪当前帧的剩余时间。
+ *
+ * @since 26.1.0
+ */
+typedef struct ArkUI_IdleDeadline ArkUI_IdleDeadline;
+
 /**
  * @brief Enumerates the alignment modes.
  *
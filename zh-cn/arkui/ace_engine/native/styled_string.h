@@ -3428,6 +3428,95 @@ ArkUI_ErrorCode OH_ArkUI_ParagraphStyle_SetTailIndents(
 ArkUI_ErrorCode OH_ArkUI_ParagraphStyle_GetTailIndents(const OH_ArkUI_ParagraphStyle* paragraphStyle,
     float** tailIndents, uint32_t tailIndentsSize, uint32_t* writeLength);
 
+/**
+ * @brief 定义预计算了文本布局、并在编辑后增量更新布局的属性字符串。
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_ArkUI_PrecomputedStyledString OH_ArkUI_PrecomputedStyledString;
+
+/**
+ * @brief 创建预计算属性字符串，并对属性字符串的内容进行布局。
+ *
+ * 创建后，通过{@link OH_ArkUI_StyledString_Descriptor_InsertString}、
+ * {@link OH_ArkUI_StyledString_Descriptor_RemoveString}等接口对描述对象的编辑会被记录，
+ * {@link OH_ArkUI_PrecomputedStyledString_Relayout}仅对受影响的文本段和行重新排版。
+ *
+ * @note 所有输入指针参数必须由调用者负责分配、管理和释放。
+ *     在预计算属性字符串销毁前，描述对象必须保持有效。
+ * @param descriptor 指向{@link ArkUI_StyledString_Descriptor}对象的指针。
+ * @param maxWidth 单行最大宽度，单位为px。
+ * @return 返回预计算属性字符串的指针，参数错误时返回<b>NULL</b>。
+ * @since 26.1.0
+ */
+OH_ArkUI_PrecomputedStyledString* OH_ArkUI_PrecomputedStyledString_Create(
+    ArkUI_StyledString_Descriptor* descriptor, float maxWidth);
+
+/**
+ * @brief 销毁预计算属性字符串，绑定的描述对象不会被销毁。
+ *
+ * @param precomputed 指向OH_ArkUI_PrecomputedStyledString对象的指针。
+ * @since 26.1.0
+ */
+void OH_ArkUI_PrecomputedStyledString_Destroy(OH_ArkUI_PrecomputedStyledString* precomputed);
+
+/**
+ * @brief 在绑定的描述对象被编辑后，更新预计算属性字符串的布局。
+ *
+ * 仅重新排版与编辑范围重叠的文本段。断行从第一个受影响的行开始，当某一行的边界与上次布局一致时停止，其余行直接复用。
+ * 若上次布局后描述对象未被编辑，该接口不做任何处理。
+ *
+ * @param precomputed 指向OH_ArkUI_PrecomputedStyledString对象的指针。
+ * @return 返回结果。\n
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。\n
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。\n
+ *         {@link ARKUI_ERROR_CODE_INVALID_STYLED_STRING} 属性字符串无效。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_PrecomputedStyledString_Relayout(OH_ArkUI_PrecomputedStyledString* precomputed);
+
+/**
+ * @brief 设置预计算属性字符串的单行最大宽度。
+ *
+ * 已排版的文本段会被保留，仅重新断行。
+ *
+ * @param precomputed 指向OH_ArkUI_PrecomputedStyledString对象的指针。
+ * @param maxWidth 单行最大宽度，单位为px。
+ * @return 返回结果。\n
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。\n
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_PrecomputedStyledString_SetMaxWidth(
+    OH_ArkUI_PrecomputedStyledString* precomputed, float maxWidth);
+
+/**
+ * @brief 获取预计算属性字符串上次布局中复用的行数和重新排版的行数。
+ *
+ * @param precomputed 指向OH_ArkUI_PrecomputedStyledString对象的指针。
+ * @param reusedLineCount 直接复用上次布局、未重新排版的行数。
+ * @param reshapedLineCount 重新排版或重新断行的行数。
+ * @return 返回结果。\n
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。\n
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_PrecomputedStyledString_GetRelayoutLineCount(
+    const OH_ArkUI_PrecomputedStyledString* precomputed, uint32_t* reusedLineCount, uint32_t* reshapedLineCount);
+
+/**
+ * @brief 将预计算属性字符串设置给文本。当文本的内容宽度与预计算属性字符串的单行最大宽度相同时，文本直接使用预计算的布局。
+ *
+ * @param controller 文本的控制器。
+ * @param precomputed 指向OH_ArkUI_PrecomputedStyledString对象的指针。
+ * @return 返回结果。\n
+ *         {@link ARKUI_ERROR_CODE_NO_ERROR} 成功。\n
+ *         {@link ARKUI_ERROR_CODE_PARAM_INVALID} 函数参数异常。
+ * @since 26.1.0
+ */
+ArkUI_ErrorCode OH_ArkUI_TextController_SetPrecomputedStyledString(
+    OH_ArkUI_TextController* controller, OH_ArkUI_PrecomputedStyledString* precomputed);
+
 #ifdef __cplusplus
 };
 #endif
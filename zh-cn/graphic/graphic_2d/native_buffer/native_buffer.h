@@ -417,6 +417,91 @@ int32_t OH_NativeBuffer_IsSupported(OH_NativeBuffer_Config config, bool* isSuppo
  * @version 1.0
  */
 int32_t OH_NativeBuffer_MapAndGetConfig(OH_NativeBuffer* buffer, void** virAddr, OH_NativeBuffer_Config* config);
+
+/**
+ * @brief 提供OH_NativeBuffer_Pool结构体类型，表示从一块共享内存中子分配多个OH_NativeBuffer的buffer池。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct OH_NativeBuffer_Pool OH_NativeBuffer_Pool;
+
+/**
+ * @brief 创建一个由一块共享内存支撑的OH_NativeBuffer_Pool实例。\n
+ * 从buffer池中分配小buffer，可避免每次单独分配的内存分配、映射开销和文件描述符占用。\n
+ * 本接口需要与OH_NativeBuffer_DestroyPool接口配合使用，否则会存在内存泄露。\n
+ * buffer池内部进行同步，可在任意线程从中分配buffer或解引用buffer。\n
+ * 本接口为线程安全类型接口。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param size 共享内存的大小，单位为字节。
+ * @param usage 共享内存的buffer用途组合，从buffer池分配的buffer只能使用这些用途。
+ * @param pool 一个指向创建的OH_NativeBuffer_Pool实例的二级指针，作为出参使用。
+ * @return 执行成功时返回NATIVE_ERROR_OK。\n
+ * pool为空指针或size为0时返回NATIVE_ERROR_INVALID_ARGUMENTS。\n
+ * 不支持usage时返回NATIVE_ERROR_UNSUPPORTED。\n
+ * 内存分配失败时返回NATIVE_ERROR_MEM_OPERATION_ERROR。\n
+ * 其他返回值可参考OHNativeErrorCode。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_CreatePool(uint64_t size, int32_t usage, OH_NativeBuffer_Pool** pool);
+
+/**
+ * @brief 销毁OH_NativeBuffer_Pool实例。\n
+ * 已从buffer池中分配的buffer仍然有效，共享内存在这些buffer全部解引用后释放，解引用可发生在任意线程。\n
+ * 调用本接口后，不得再将该buffer池传给其他接口。\n
+ * 本接口为线程安全类型接口。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool 一个指向OH_NativeBuffer_Pool实例的指针。
+ * @return 执行成功时返回NATIVE_ERROR_OK。\n
+ * pool为空指针时返回NATIVE_ERROR_INVALID_ARGUMENTS。\n
+ * 其他返回值可参考OHNativeErrorCode。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_DestroyPool(OH_NativeBuffer_Pool* pool);
+
+/**
+ * @brief 从OH_NativeBuffer_Pool中分配一个与传入配置相匹配的OH_NativeBuffer。\n
+ * 该buffer的使用方式与OH_NativeBuffer_Alloc创建的buffer相同，通过OH_NativeBuffer_Unreference解引用后其内存归还buffer池。
+ * 通过OH_NativeBuffer_WriteToParcel将该buffer写入OHIPCParcel时，共享的是buffer池的文件描述符和该buffer的偏移，
+ * 读取同一buffer池中多个buffer的进程只需映射一次buffer池。
+ * 因此，接收进程可以映射并访问buffer池中所有buffer的内存，包括未与其共享的buffer。
+ * 仅应将buffer池中的buffer共享给允许访问该buffer池全部buffer的进程，需要共享给其他进程的buffer请通过OH_NativeBuffer_Alloc分配。\n
+ * 本接口为线程安全类型接口。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool 一个指向OH_NativeBuffer_Pool实例的指针。
+ * @param config 一个指向OH_NativeBuffer_Config的结构体实例的指针。
+ * @param buffer 一个指向分配的OH_NativeBuffer实例的二级指针，作为出参使用。
+ * @return 执行成功时返回NATIVE_ERROR_OK。\n
+ * pool、config或buffer为空指针，或config的usage不包含在buffer池的usage中时返回NATIVE_ERROR_INVALID_ARGUMENTS。\n
+ * buffer池的空闲内存不足时返回NATIVE_ERROR_NO_BUFFER。\n
+ * 其他返回值可参考OHNativeErrorCode。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_AllocFromPool(OH_NativeBuffer_Pool* pool, const OH_NativeBuffer_Config* config,
+    OH_NativeBuffer** buffer);
+
+/**
+ * @brief 获取OH_NativeBuffer_Pool的内存使用情况。\n
+ * 本接口为线程安全类型接口。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool 一个指向OH_NativeBuffer_Pool实例的指针。
+ * @param usedSize 已分配给buffer的内存大小，单位为字节，作为出参使用。
+ * @param largestFreeSize 最大空闲内存块的大小，单位为字节，作为出参使用。
+ * @return 执行成功时返回NATIVE_ERROR_OK。\n
+ * pool、usedSize或largestFreeSize为空指针时返回NATIVE_ERROR_INVALID_ARGUMENTS。\n
+ * 其他返回值可参考OHNativeErrorCode。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_GetPoolUsage(OH_NativeBuffer_Pool* pool, uint64_t* usedSize, uint64_t* largestFreeSize);
 #ifdef __cplusplus
 }
 #endif
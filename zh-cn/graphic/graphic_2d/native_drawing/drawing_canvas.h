@@ -1146,6 +1146,31 @@ OH_Drawing_ErrorCode OH_Drawing_CanvasQuickRejectRect(OH_Drawing_Canvas* canvas,
  */
 OH_Drawing_ErrorCode OH_Drawing_CanvasIsOpaque(const OH_Drawing_Canvas* canvas, bool* isOpaque);
 
+/**
+ * @brief 以一次批量绘制调用绘制来自同一张图片的多个精灵。
+ * 第i个精灵为图集图片中srcRects[i]对应的区域，经xforms[i]变换后绘制；colors不为NULL时，使用指定的混合模式与colors[i]混合。
+ * 精灵按数组顺序使用画布当前设置的画刷绘制，并作为一个绘制操作录制和提交。
+ *
+ * @param canvas 指向画布对象{@link OH_Drawing_Canvas}的指针。
+ * @param atlas 指向包含所有精灵的图片对象{@link OH_Drawing_Image}的指针。
+ * @param xforms 指向{@link OH_Drawing_RSXform}变换数组的指针，每个精灵对应一个变换。
+ * @param srcRects 指向通过{@link OH_Drawing_RectCreateArray}创建的矩形数组的指针，保存每个精灵在图集图片中的区域。
+ * @param colors 指向ARGB格式颜色数组的指针，每个精灵对应一个颜色，可以为NULL。
+ * @param count 精灵数量，不能超过srcRects的大小。
+ * @param mode 精灵颜色与图集图片的混合模式，支持可选的具体模式可见{@link OH_Drawing_BlendMode}枚举。colors为NULL时忽略该参数。
+ * @param samplingOptions 指向采样选项对象{@link OH_Drawing_SamplingOptions}的指针，为NULL时使用默认采样选项。
+ * @param cullRect 指向所有精灵变换后的边界的指针，用于快速剔除，可以为NULL。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数canvas、atlas、xforms或者srcRects为空。
+ *     <br>返回OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE，表示count超过srcRects的大小，或者mode不在枚举范围内。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawAtlas(OH_Drawing_Canvas* canvas, const OH_Drawing_Image* atlas,
+    const OH_Drawing_RSXform* xforms, OH_Drawing_Array* srcRects, const uint32_t* colors, size_t count,
+    OH_Drawing_BlendMode mode, const OH_Drawing_SamplingOptions* samplingOptions, const OH_Drawing_Rect* cullRect);
+
 #ifdef __cplusplus
 }
 #endif
@@ -836,6 +836,78 @@ OH_Drawing_ErrorCode OH_Drawing_FontSetThemeFontFollowed(OH_Drawing_Font* font,
  */
 OH_Drawing_ErrorCode OH_Drawing_FontIsThemeFontFollowed(const OH_Drawing_Font* font, bool* followed);
 
+/**
+ * @brief 进程级字形缓存的统计信息。字形缓存保存{@link OH_Drawing_CanvasDrawTextBlob}和
+ * {@link OH_Drawing_CanvasDrawSingleCharacter}使用的光栅化字形。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct OH_Drawing_GlyphCacheStatistics {
+    /** 从缓存中获取字形的次数。 */
+    uint64_t hitCount;
+    /** 需要重新光栅化字形的次数。 */
+    uint64_t missCount;
+    /** 缓存中当前保存的字形数量。 */
+    uint32_t glyphCount;
+    /** 缓存当前占用的内存大小，单位为字节。 */
+    size_t usedBytes;
+    /** 缓存的内存预算，单位为字节。 */
+    size_t budgetBytes;
+} OH_Drawing_GlyphCacheStatistics;
+
+/**
+ * @brief 设置进程级字形缓存的内存预算。超出预算时，淘汰最久未使用的字形。该接口设置后整个进程都会生效。
+ *
+ * @param budgetBytes 字形缓存的内存预算，单位为字节。取值为0表示恢复默认预算。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_SetGlyphCacheBudget(size_t budgetBytes);
+
+/**
+ * @brief 设置某个字体的字形在进程级字形缓存中可占用的最大内存。超出限制时，淘汰该字体最久未使用的字形，避免单个字体挤占其他字体的字形。
+ *
+ * @param typeface 指向字体对象{@link OH_Drawing_Typeface}的指针。
+ * @param limitBytes 该字体的字形可占用的最大内存，单位为字节。取值为0表示仅受{@link OH_Drawing_SetGlyphCacheBudget}设置的预算限制。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数typeface为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_SetTypefaceGlyphCacheLimit(const OH_Drawing_Typeface* typeface, size_t limitBytes);
+
+/**
+ * @brief 获取进程级字形缓存的统计信息。
+ *
+ * @param statistics 指向{@link OH_Drawing_GlyphCacheStatistics}对象的指针，作为出参使用。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数statistics为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_GetGlyphCacheStatistics(OH_Drawing_GlyphCacheStatistics* statistics);
+
+/**
+ * @brief 预先光栅化字形并保存到进程级字形缓存中，避免首次绘制这些字形的帧承担光栅化开销。
+ * <br>字形按照字型对象的字体、字号等属性光栅化，已缓存的字形会被跳过。
+ *
+ * @param font 指向字型对象{@link OH_Drawing_Font}的指针。
+ * @param glyphs 字形索引数组的首地址，可通过{@link OH_Drawing_FontTextToGlyphs}获取。
+ * @param count 字形索引数组的长度。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数font或glyphs为空，或者count为0。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_FontPrewarmGlyphs(const OH_Drawing_Font* font, const uint16_t* glyphs,
+    uint32_t count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1023,6 +1023,55 @@ OH_Drawing_ErrorCode OH_Drawing_PathToggleInverseFillType(OH_Drawing_Path* path)
  */
 OH_Drawing_ErrorCode OH_Drawing_PathIsEqual(OH_Drawing_Path* path, OH_Drawing_Path* other, bool* equal);
 
+/**
+ * @brief 获取路径的生成ID。路径的几何数据每次发生变化时，生成ID都会改变。
+ * <br>通过{@link OH_Drawing_PathCopy}或{@link OH_Drawing_PathSetPath}共享几何数据的路径具有相同的生成ID。
+ *
+ * @param path 指向路径对象{@link OH_Drawing_Path}的指针。
+ * @param generationId 指向生成ID的指针，作为出参使用。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数path或generationId为空指针。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_PathGetGenerationId(const OH_Drawing_Path* path, uint32_t* generationId);
+
+/**
+ * @brief 设置是否缓存路径的曲面细分结果。
+ * <br>开启缓存后，绘制路径时生成的曲面细分结果以路径的生成ID为键保留，后续绘制的矩阵缩放比例相同时（例如路径仅发生平移或旋转）可直接复用。
+ * <br>路径的几何数据发生变化或关闭缓存时，缓存被丢弃。默认不开启缓存。
+ *
+ * @param path 指向路径对象{@link OH_Drawing_Path}的指针。
+ * @param enabled 是否缓存曲面细分结果。true表示缓存，false表示不缓存。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数path为空指针。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_PathSetTessellationCacheEnabled(OH_Drawing_Path* path, bool enabled);
+
+/**
+ * @brief 按照指定的路径操作类型，将一个路径与多个路径进行运算。
+ * <br>所有路径在一次处理中完成运算，合并大型多边形时比对每个路径依次调用{@link OH_Drawing_PathOp}更快。
+ * <br>运算结果与按顺序对每个路径调用{@link OH_Drawing_PathOp}的结果相同。
+ *
+ * @param path 指向路径对象{@link OH_Drawing_Path}的指针，运算结果保存在该路径中。
+ * @param others 参与运算的路径对象{@link OH_Drawing_Path}数组的首地址。
+ * @param count 数组中路径的数量。
+ * @param op 路径操作类型，支持可选的具体类型可见{@link OH_Drawing_PathOpMode}枚举。
+ * @param isEmpty 运算结果路径是否为空，作为出参使用。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数path、others、others中的元素或isEmpty为空指针，或者count为0。
+ *     <br>返回OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE，表示参数op不在枚举范围内。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_PathOpMultiple(OH_Drawing_Path* path, const OH_Drawing_Path* const* others,
+    size_t count, OH_Drawing_PathOpMode op, bool* isEmpty);
+
 #ifdef __cplusplus
 }
 #endif
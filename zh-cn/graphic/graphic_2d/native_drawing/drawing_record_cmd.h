@@ -120,6 +120,112 @@ OH_Drawing_ErrorCode OH_Drawing_RecordCmdUtilsFinishRecording(OH_Drawing_RecordC
  */
 OH_Drawing_ErrorCode OH_Drawing_RecordCmdDestroy(OH_Drawing_RecordCmd* recordCmd);
 
+/**
+ * @brief 将录制指令对象序列化为紧凑的二进制数据，可用于存储（例如存储到磁盘），之后通过{@link OH_Drawing_RecordCmdCreateFromStream}恢复。
+ * <br>被多个绘制指令使用的图片和字体只保存一份。
+ * <br>buffer为NULL时，仅通过dataSize返回序列化数据的大小。
+ *
+ * @param recordCmd 指向录制指令对象{@link OH_Drawing_RecordCmd}的指针。
+ * @param buffer 指向接收序列化数据的缓冲区的指针，可以为NULL。
+ * @param bufferSize 缓冲区大小，单位为字节。
+ * @param dataSize 指向序列化数据大小的指针，单位为字节，作为出参使用。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数recordCmd或dataSize为空。
+ *     <br>返回OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE，表示buffer不为空且bufferSize小于序列化数据的大小。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdSerialize(const OH_Drawing_RecordCmd* recordCmd, void* buffer,
+    size_t bufferSize, size_t* dataSize);
+
+/**
+ * @brief 根据{@link OH_Drawing_RecordCmdSerialize}序列化的数据创建录制指令对象。
+ * <br>数据会被拷贝，内存流的所有权不转移。无论本接口执行成功或失败，都需要调用{@link OH_Drawing_MemoryStreamDestroy}释放内存流，
+ * 本接口返回后即可释放。
+ *
+ * @param memoryStream 指向保存序列化数据的内存流对象{@link OH_Drawing_MemoryStream}的指针。
+ * @param recordCmd 指向创建的录制指令对象{@link OH_Drawing_RecordCmd}的二级指针，作为出参。
+ *     需要调用{@link OH_Drawing_RecordCmdDestroy}接口释放。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数memoryStream或recordCmd为空。
+ *     <br>返回OH_DRAWING_ERROR_FILE_CORRUPTED，表示数据已损坏或由不兼容的版本序列化。
+ *     <br>返回OH_DRAWING_ERROR_ALLOCATION_FAILED，表示系统内存不足。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdCreateFromStream(const OH_Drawing_MemoryStream* memoryStream,
+    OH_Drawing_RecordCmd** recordCmd);
+
+/**
+ * @brief 获取录制指令对象中所有绘制指令的边界。
+ *
+ * @param recordCmd 指向录制指令对象{@link OH_Drawing_RecordCmd}的指针。
+ * @param bounds 指向矩形对象{@link OH_Drawing_Rect}的指针，作为出参使用。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数recordCmd或bounds为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdGetBounds(const OH_Drawing_RecordCmd* recordCmd, OH_Drawing_Rect* bounds);
+
+/**
+ * @brief 获取录制指令对象中的绘制指令数量。
+ *
+ * @param recordCmd 指向录制指令对象{@link OH_Drawing_RecordCmd}的指针。
+ * @param opCount 指向绘制指令数量的指针，作为出参使用。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数recordCmd或opCount为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdGetOpCount(const OH_Drawing_RecordCmd* recordCmd, uint32_t* opCount);
+
+/**
+ * @brief 在CPU上将录制指令对象光栅化到位图。位图被划分为多个图块，各图块并行光栅化。
+ * <br>对于某个图块，边界与该图块不相交的绘制指令会被跳过。
+ * <br>结果与图块大小和线程数无关，与将threadCount设为1、使用覆盖整个位图的单个图块调用本接口的结果逐像素一致，
+ * 后者在绑定该位图的单个画布上按录制顺序串行回放绘制指令。
+ *
+ * @param recordCmd 指向录制指令对象{@link OH_Drawing_RecordCmd}的指针。
+ * @param bitmap 指向绘制目标位图对象{@link OH_Drawing_Bitmap}的指针，位图的像素内存必须已分配。
+ * @param tileWidth 图块宽度，单位为px。值为0时，由系统选择图块宽度。
+ * @param tileHeight 图块高度，单位为px。值为0时，由系统选择图块高度。
+ * @param threadCount 光栅化使用的最大线程数。值为0时，由系统选择线程数；值为1时，在调用线程上光栅化所有图块。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数recordCmd或bitmap为空，或者bitmap的像素内存未分配。
+ *     <br>返回OH_DRAWING_ERROR_ALLOCATION_FAILED，表示系统内存不足。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdRasterizeToBitmap(const OH_Drawing_RecordCmd* recordCmd,
+    OH_Drawing_Bitmap* bitmap, uint32_t tileWidth, uint32_t tileHeight, uint32_t threadCount);
+
+/**
+ * @brief 在CPU上将录制指令对象光栅化到像素图。像素图被划分为多个图块，各图块并行光栅化。
+ * <br>对于某个图块，边界与该图块不相交的绘制指令会被跳过。
+ * <br>结果与图块大小和线程数无关，与将threadCount设为1、使用覆盖整个像素图的单个图块调用本接口的结果逐像素一致，
+ * 后者在通过{@link OH_Drawing_CanvasCreateWithPixelMap}由该像素图创建的单个画布上按录制顺序串行回放绘制指令。
+ *
+ * @param recordCmd 指向录制指令对象{@link OH_Drawing_RecordCmd}的指针。
+ * @param pixelMap 指向绘制目标像素图对象{@link OH_Drawing_PixelMap}的指针。
+ * @param tileWidth 图块宽度，单位为px。值为0时，由系统选择图块宽度。
+ * @param tileHeight 图块高度，单位为px。值为0时，由系统选择图块高度。
+ * @param threadCount 光栅化使用的最大线程数。值为0时，由系统选择线程数；值为1时，在调用线程上光栅化所有图块。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数recordCmd或pixelMap为空。
+ *     <br>返回OH_DRAWING_ERROR_ALLOCATION_FAILED，表示系统内存不足。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_RecordCmdRasterizeToPixelMap(const OH_Drawing_RecordCmd* recordCmd,
+    OH_Drawing_PixelMap* pixelMap, uint32_t tileWidth, uint32_t tileHeight, uint32_t threadCount);
+
 #ifdef __cplusplus
 }
 #endif
@@ -40,6 +40,9 @@
 #ifndef DRAWING_TEXT_GLOBAL_H
 #define DRAWING_TEXT_GLOBAL_H
 
+#include <stdint.h>
+#include "drawing_error_code.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -102,6 +105,56 @@ void OH_Drawing_SetTextHighContrast(OH_Drawing_TextHighContrast action);
  * @since 20
  */
 void OH_Drawing_SetTextUndefinedGlyphDisplay(OH_Drawing_TextUndefinedGlyphDisplay undefinedGlyphDisplay);
+
+/**
+ * @brief 进程级字形排布（shaping）缓存的统计信息。
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_Drawing_ShapingCacheStatistics {
+    /** 从缓存中获取排布结果的次数。 */
+    uint64_t hitCount;
+    /** 需要重新排布文本的次数。 */
+    uint64_t missCount;
+    /** 缓存中当前保存的排布结果数量。 */
+    uint32_t entryCount;
+    /** 缓存可保存的最大排布结果数量。 */
+    uint32_t capacity;
+} OH_Drawing_ShapingCacheStatistics;
+
+/**
+ * @brief 设置进程级字形排布缓存的容量。
+ * <br>缓存以文本内容、文本样式和字体集为键保存排布结果，为相同字符串（例如列表中的标签、时间戳）创建的排版对象可复用排布结果，无需重新排布。
+ * 缓存已满时，淘汰最久未使用的排布结果。
+ * <br>该接口设置后整个进程都会生效。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param capacity 缓存可保存的最大排布结果数量。取值为0表示关闭缓存，并释放缓存中的排布结果。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ * @since 26.1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_SetShapingCacheCapacity(uint32_t capacity);
+
+/**
+ * @brief 获取进程级字形排布缓存的统计信息。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param statistics 指向{@link OH_Drawing_ShapingCacheStatistics}对象的指针，作为出参使用。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数statistics为空。
+ * @since 26.1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_GetShapingCacheStatistics(OH_Drawing_ShapingCacheStatistics* statistics);
+
+/**
+ * @brief 释放进程级字形排布缓存中的所有排布结果，并重置统计信息。不改变缓存容量。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @since 26.1.0
+ */
+void OH_Drawing_ClearShapingCache(void);
 #ifdef __cplusplus
 }
 #endif
@@ -1728,6 +1728,8 @@ void OH_Drawing_DestroyTypography(OH_Drawing_Typography* typography);
 
 /**
  * @brief 对排版对象进行布局计算，根据指定的最大宽度对文本进行换行。调用该接口后，排版对象的各项属性才可被正确获取。
+ * 从API version 26.1.0开始，不同的排版对象即使共享同一个{@link OH_Drawing_FontCollection}，也可以在不同线程中并发布局。
+ * 同一个排版对象不能被并发布局。
  *
  * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
  * @param typography 指向排版对象{@link OH_Drawing_Typography}的指针，由{@link OH_Drawing_CreateTypography}获取。
@@ -3875,6 +3877,40 @@ OH_Drawing_Range* OH_Drawing_TypographyGetGlyphRangeForCharacterRangeWithBuffer(
  */
 void OH_Drawing_ReleaseRangeBuffer(OH_Drawing_Range* range);
 
+/**
+ * @brief 复用上一次布局的字形排布结果，按新的最大宽度重新布局排版对象。
+ * 仅重新计算换行、对齐和行度量，不会重新排布文本。需要在{@link OH_Drawing_TypographyLayout}之后调用。
+ * 如果上一次布局后文本样式被更新（例如通过{@link OH_Drawing_TypographyUpdateFontSize}），则对排版对象进行完整布局。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param typography 指向排版对象{@link OH_Drawing_Typography}的指针，由{@link OH_Drawing_CreateTypography}获取。
+ * @param maxWidth 文本排版的单行最大宽度，单位为物理像素px。取值应大于0。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数typography为空或尚未布局。
+ *     <br>返回OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE，表示maxWidth不大于0。
+ * @since 26.1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_TypographyRelayout(OH_Drawing_Typography* typography, double maxWidth);
+
+/**
+ * @brief 在系统工作线程池中并行布局一批排版对象。
+ * 每个排版对象的布局结果与使用对应的最大宽度调用{@link OH_Drawing_TypographyLayout}相同。所有排版对象布局完成后该接口才返回。
+ * 排版对象之间不能重复，调用期间其他线程不能访问这些排版对象。排版对象可以共享同一个{@link OH_Drawing_FontCollection}。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param typographies 指向排版对象{@link OH_Drawing_Typography}数组的指针，排版对象由{@link OH_Drawing_CreateTypography}获取。
+ * @param maxWidths 指向单行最大宽度数组的指针，单位为物理像素px。数组长度需等于count，每个取值应大于0。
+ * @param count 排版对象的数量。
+ * @return 函数返回执行错误码。
+ *     <br>返回OH_DRAWING_SUCCESS，表示执行成功。
+ *     <br>返回OH_DRAWING_ERROR_INCORRECT_PARAMETER，表示参数typographies或maxWidths为空，typographies中存在空元素，或者count为0。
+ *     <br>返回OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE，表示存在不大于0的最大宽度。
+ * @since 26.1.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_TypographyLayoutBatch(OH_Drawing_Typography** typographies, const double* maxWidths,
+    size_t count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -190,6 +190,40 @@ typedef struct {
     float z;
 } OH_Drawing_Point3D;
 
+/**
+ * @brief 旋转-缩放-平移变换，等价于矩阵[scaleCos, -scaleSin, translateX; scaleSin, scaleCos, translateY; 0, 0, 1]。
+ * 用于在{@link OH_Drawing_CanvasDrawAtlas}中放置精灵。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct {
+    /**
+     * @brief 旋转角度的余弦值与缩放系数的乘积。
+     *
+     * @since 26.1.0
+     */
+    float scaleCos;
+    /**
+     * @brief 旋转角度的正弦值与缩放系数的乘积。
+     *
+     * @since 26.1.0
+     */
+    float scaleSin;
+    /**
+     * @brief x轴方向的平移量。
+     *
+     * @since 26.1.0
+     */
+    float translateX;
+    /**
+     * @brief y轴方向的平移量。
+     *
+     * @since 26.1.0
+     */
+    float translateY;
+} OH_Drawing_RSXform;
+
 /**
  * @brief 定义一个路径效果，用于影响描边路径。
  *
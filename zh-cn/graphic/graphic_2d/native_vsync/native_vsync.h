@@ -181,6 +181,200 @@ int OH_NativeVSync_DVSyncSwitch(OH_NativeVSync* nativeVsync, bool enable);
  * @version 1.0
  */
 int OH_NativeVSync_SetExpectedFrameRateRange(OH_NativeVSync* nativeVsync, OH_NativeVSync_ExpectedRateRange* range);
+
+/**
+ * @brief 提供OHNativeWindow结构体声明。
+ * @since 8
+ */
+typedef struct NativeWindow OHNativeWindow;
+/**
+ * @brief 提供OHNativeWindowBuffer结构体声明。
+ * @since 12
+ */
+typedef struct NativeWindowBuffer OHNativeWindowBuffer;
+
+/**
+ * @brief 定义帧调度器。帧调度器将OH_NativeVSync实例与NativeWindow实例关联，控制向窗口渲染的帧的节奏。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct OH_NativeVSync_FrameScheduler OH_NativeVSync_FrameScheduler;
+
+/**
+ * @brief 定义OH_NativeVSync_FrameScheduler实例调度的帧的信息。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct {
+    /** 帧ID，每调度一帧加一。 */
+    uint64_t frameId;
+    /** 该帧所属VSync信号的时间戳，单位为纳秒。 */
+    int64_t vsyncTimestamp;
+    /** 该帧的期望上屏时间，单位为纳秒。 */
+    int64_t targetPresentTimestamp;
+    /** 根据历史帧预测的渲染耗时，单位为纳秒。 */
+    int64_t predictedRenderDuration;
+} OH_NativeVSync_FrameInfo;
+
+/**
+ * @brief 定义通过OH_NativeVSync_FrameScheduler_SubmitFrame提交的帧的统计信息。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct {
+    /** 帧ID。 */
+    uint64_t frameId;
+    /** 从开始渲染到提交该帧的耗时，单位为纳秒。 */
+    int64_t renderDuration;
+    /** 从该帧所属VSync信号到该帧上屏的时延，单位为纳秒。 */
+    int64_t latency;
+    /** 该帧是否错过了期望上屏时间。 */
+    bool missed;
+} OH_NativeVSync_FrameStats;
+
+/**
+ * @brief 定义需要渲染一帧时调用的回调函数。buffer已预先从窗口申请，渲染不会阻塞在申请buffer上。
+ * fenceFd的所有权转移给回调，当fenceFd使用完，用户需要将其close。
+ * 回调在OH_NativeVSync实例的回调线程中逐帧执行，不会与OH_NativeVSync_FrameScheduler_OnFrameStats并发执行。
+ * 无需在回调返回前归还buffer，可在任意线程通过OH_NativeVSync_FrameScheduler_SubmitFrame或OH_NativeVSync_FrameScheduler_SkipFrame归还。
+ *
+ * @param scheduler 指向OH_NativeVSync_FrameScheduler实例的指针。
+ * @param buffer 指向用于渲染的窗口buffer的指针。
+ * @param fenceFd 写入buffer前需要等待的fence的文件描述符。取值为-1表示buffer可直接写入。
+ * @param info 指向该帧信息的指针。
+ * @param data 启动调度器时传入的用户数据。
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef void (*OH_NativeVSync_FrameScheduler_OnFrame)(OH_NativeVSync_FrameScheduler* scheduler,
+    OHNativeWindowBuffer* buffer, int fenceFd, const OH_NativeVSync_FrameInfo* info, void* data);
+
+/**
+ * @brief 定义帧上屏后上报该帧统计信息的回调函数。
+ * 回调在OH_NativeVSync实例的回调线程中执行，不会与OH_NativeVSync_FrameScheduler_OnFrame并发执行。
+ *
+ * @param scheduler 指向OH_NativeVSync_FrameScheduler实例的指针。
+ * @param stats 指向该帧统计信息的指针。
+ * @param data 设置回调时传入的用户数据。
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef void (*OH_NativeVSync_FrameScheduler_OnFrameStats)(OH_NativeVSync_FrameScheduler* scheduler,
+    const OH_NativeVSync_FrameStats* stats, void* data);
+
+/**
+ * @brief 创建一个OH_NativeVSync_FrameScheduler实例。
+ * 调度器会通过nativeVsync请求VSync信号，并通过window申请buffer。调度器存在期间，不要自行通过nativeVsync请求VSync信号或通过window申请buffer。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param nativeVsync 指向OH_NativeVSync实例的指针。
+ * @param window 指向NativeWindow实例的指针。
+ * @return 返回一个指向OH_NativeVSync_FrameScheduler实例的指针。nativeVsync或window为空时返回NULL。
+ * @since 26.1.0
+ * @version 1.0
+ */
+OH_NativeVSync_FrameScheduler* OH_NativeVSync_FrameScheduler_Create(OH_NativeVSync* nativeVsync,
+    OHNativeWindow* window);
+
+/**
+ * @brief 销毁OH_NativeVSync_FrameScheduler实例。调度器会按OH_NativeVSync_FrameScheduler_Stop的方式停止调度：
+ * 已申请但未交付的buffer，以及已通过OH_NativeVSync_FrameScheduler_OnFrame交付但尚未提交或跳过的buffer，均会不上屏直接归还窗口。
+ * 不要在调度器的回调中调用本接口，调度器销毁后不要再使用。
+ * 不会销毁OH_NativeVSync实例和NativeWindow实例。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler 指向OH_NativeVSync_FrameScheduler实例的指针。
+ * @since 26.1.0
+ * @version 1.0
+ */
+void OH_NativeVSync_FrameScheduler_Destroy(OH_NativeVSync_FrameScheduler* scheduler);
+
+/**
+ * @brief 开始帧调度。
+ * 每个VSync周期内，调度器预先申请下一个buffer，根据历史帧预测渲染耗时，并在相对VSync信号的合适偏移处调用callback，使该帧能够按时上屏。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler 指向OH_NativeVSync_FrameScheduler实例的指针。
+ * @param callback 需要渲染一帧时调用的回调函数。
+ * @param data 回调函数的入参，用户自定义数据。
+ * @return NATIVE_ERROR_OK 0 - 成功。\n
+ *     NATIVE_ERROR_INVALID_ARGUMENTS 40001000 - 参数scheduler或callback为空。\n
+ *     NATIVE_ERROR_INVALID_OPERATION 41201000 - 调度器已启动。\n
+ *     NATIVE_ERROR_BINDER_ERROR 50401000 - 跨进程通信失败。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_Start(OH_NativeVSync_FrameScheduler* scheduler,
+    OH_NativeVSync_FrameScheduler_OnFrame callback, void* data);
+
+/**
+ * @brief 停止帧调度。
+ * 已申请但未交付的buffer，以及已通过OH_NativeVSync_FrameScheduler_OnFrame交付但尚未提交或跳过的buffer，均会不上屏直接归还窗口。
+ * 之后对这些buffer调用OH_NativeVSync_FrameScheduler_SubmitFrame或OH_NativeVSync_FrameScheduler_SkipFrame
+ * 会返回NATIVE_ERROR_BUFFER_STATE_INVALID，传入OH_NativeVSync_FrameScheduler_SubmitFrame的fenceFd仍会被关闭。
+ * 在调度器的回调之外调用时，本接口会等待正在执行的回调返回后再返回。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler 指向OH_NativeVSync_FrameScheduler实例的指针。
+ * @return NATIVE_ERROR_OK 0 - 成功。\n
+ *     NATIVE_ERROR_INVALID_ARGUMENTS 40001000 - 参数scheduler为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_Stop(OH_NativeVSync_FrameScheduler* scheduler);
+
+/**
+ * @brief 提交渲染完成的帧。buffer以该帧的期望上屏时间提交到窗口，渲染耗时会被记录用于预测后续帧。
+ * 通过OH_NativeVSync_FrameScheduler_OnFrame交付的每个buffer，除非调度器已先停止，都必须且只能通过本接口提交一次，
+ * 或通过OH_NativeVSync_FrameScheduler_SkipFrame跳过一次。本接口可在任意线程调用。
+ * 系统会将fenceFd关闭，返回错误时也是如此，无需用户close。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler 指向OH_NativeVSync_FrameScheduler实例的指针。
+ * @param buffer 指向通过回调交付的窗口buffer的指针。
+ * @param fenceFd 渲染完成时发出信号的fence的文件描述符。取值为-1表示渲染已完成。
+ * @return NATIVE_ERROR_OK 0 - 成功。\n
+ *     NATIVE_ERROR_INVALID_ARGUMENTS 40001000 - 参数scheduler或buffer为空。\n
+ *     NATIVE_ERROR_BUFFER_STATE_INVALID 41207000 - buffer不是由调度器交付的，已经提交或跳过，或者已在调度器停止时归还窗口。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_SubmitFrame(OH_NativeVSync_FrameScheduler* scheduler,
+    OHNativeWindowBuffer* buffer, int fenceFd);
+
+/**
+ * @brief 跳过一帧。buffer不上屏直接归还窗口，窗口继续显示上一帧，该帧不参与后续帧渲染耗时的预测。
+ * 通过OH_NativeVSync_FrameScheduler_OnFrame交付的帧不需要渲染时，使用本接口代替OH_NativeVSync_FrameScheduler_SubmitFrame。
+ * 本接口可在任意线程调用。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler 指向OH_NativeVSync_FrameScheduler实例的指针。
+ * @param buffer 指向通过回调交付的窗口buffer的指针。
+ * @return NATIVE_ERROR_OK 0 - 成功。\n
+ *     NATIVE_ERROR_INVALID_ARGUMENTS 40001000 - 参数scheduler或buffer为空。\n
+ *     NATIVE_ERROR_BUFFER_STATE_INVALID 41207000 - buffer不是由调度器交付的，已经提交或跳过，或者已在调度器停止时归还窗口。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_SkipFrame(OH_NativeVSync_FrameScheduler* scheduler, OHNativeWindowBuffer* buffer);
+
+/**
+ * @brief 设置上报每个已上屏帧统计信息的回调函数。
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeVsync
+ * @param scheduler 指向OH_NativeVSync_FrameScheduler实例的指针。
+ * @param callback 回调函数。取值为NULL表示停止上报统计信息。
+ * @param data 回调函数的入参，用户自定义数据。
+ * @return NATIVE_ERROR_OK 0 - 成功。\n
+ *     NATIVE_ERROR_INVALID_ARGUMENTS 40001000 - 参数scheduler为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_NativeVSync_FrameScheduler_SetFrameStatsCallback(OH_NativeVSync_FrameScheduler* scheduler,
+    OH_NativeVSync_FrameScheduler_OnFrameStats callback, void* data);
 #ifdef __cplusplus
 }
 #endif
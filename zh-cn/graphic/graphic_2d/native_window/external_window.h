@@ -39,6 +39,7 @@
 #ifndef NDK_INCLUDE_EXTERNAL_NATIVE_WINDOW_H_
 #define NDK_INCLUDE_EXTERNAL_NATIVE_WINDOW_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "buffer_handle.h"
 #include "../native_buffer/buffer_common.h"
@@ -942,6 +943,82 @@ int32_t OH_NativeWindow_Set3DMetadataValue(OHNativeWindow *window, OH_NativeBuff
  */
 int32_t OH_NativeWindow_Get3DMetadataValue(OHNativeWindow *window, OH_NativeBuffer_3D_MetadataKey metadataKey,
     int32_t *size, uint8_t **metadata);
+
+/**
+ * @brief OHNativeWindowBufferQueueStats中申请等待时间直方图的分桶数量。
+ * @since 26.1.0
+ */
+#define OH_NATIVE_WINDOW_WAIT_HISTOGRAM_BUCKET_COUNT 8
+
+/**
+ * @brief 本地窗口的buffer队列统计信息。统计范围为从窗口创建或上次调用OH_NativeWindow_ResetBufferQueueStats至今。
+ * @since 26.1.0
+ */
+typedef struct {
+    /** buffer队列中的buffer数量。 */
+    uint32_t queueSize;
+    /** 当前已被生产者申请，或已提交但尚未被消费者释放的buffer数量。 */
+    uint32_t buffersInFlight;
+    /** buffer申请次数。 */
+    uint64_t requestCount;
+    /**
+     * 按等待时间统计的buffer申请次数。各分桶的上限依次为1ms、2ms、4ms、8ms、16ms、33ms和66ms，最后一个分桶统计等待时间超过66ms的申请。
+     */
+    uint64_t requestWaitHistogram[OH_NATIVE_WINDOW_WAIT_HISTOGRAM_BUCKET_COUNT];
+    /** 单次buffer申请的最大等待时间，单位为纳秒。 */
+    int64_t maxRequestWaitTime;
+    /** buffer从提交到被消费者获取的平均时延，单位为纳秒。 */
+    int64_t averageFlushToAcquireLatency;
+    /** buffer从提交到被消费者获取的最大时延，单位为纳秒。 */
+    int64_t maxFlushToAcquireLatency;
+    /** 已提交但未被消费即被丢弃的buffer数量。 */
+    uint64_t droppedBufferCount;
+} OHNativeWindowBufferQueueStats;
+
+/**
+ * @brief 获取OHNativeWindow的buffer队列统计信息。\n
+ * 本接口为非线程安全类型接口。\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeWindow
+ * @param window 一个指向OHNativeWindow的结构体实例的指针。
+ * @param stats 一个指向OHNativeWindowBufferQueueStats的结构体实例的指针，作为出参使用。
+ * @return NATIVE_ERROR_OK 0 - 成功。\n
+ *     NATIVE_ERROR_INVALID_ARGUMENTS 40001000 - window或stats为空。\n
+ *     NATIVE_ERROR_UNKNOWN 50002000 - window的surface为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeWindow_GetBufferQueueStats(OHNativeWindow *window, OHNativeWindowBufferQueueStats *stats);
+
+/**
+ * @brief 重置OHNativeWindow的buffer队列统计信息。\n
+ * 本接口为非线程安全类型接口。\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeWindow
+ * @param window 一个指向OHNativeWindow的结构体实例的指针。
+ * @return NATIVE_ERROR_OK 0 - 成功。\n
+ *     NATIVE_ERROR_INVALID_ARGUMENTS 40001000 - window为空。\n
+ *     NATIVE_ERROR_UNKNOWN 50002000 - window的surface为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeWindow_ResetBufferQueueStats(OHNativeWindow *window);
+
+/**
+ * @brief 设置是否为OHNativeWindow的buffer状态转换输出HiTrace打点。\n
+ * 开启且系统正在抓取trace时，每个buffer从申请到提交、从提交到被消费者获取、从获取到释放各输出一段打点，并标注buffer的序列号。默认不输出。\n
+ * 本接口为非线程安全类型接口。\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeWindow
+ * @param window 一个指向OHNativeWindow的结构体实例的指针。
+ * @param enabled 是否输出打点。true表示输出，false表示不输出。
+ * @return NATIVE_ERROR_OK 0 - 成功。\n
+ *     NATIVE_ERROR_INVALID_ARGUMENTS 40001000 - window为空。\n
+ *     NATIVE_ERROR_UNKNOWN 50002000 - window的surface为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int32_t OH_NativeWindow_SetBufferTraceEnabled(OHNativeWindow *window, bool enabled);
 #ifdef __cplusplus
 }
 #endif
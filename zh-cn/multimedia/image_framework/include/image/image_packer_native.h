@@ -683,6 +683,94 @@ Image_ErrorCode OH_ImagePackerNative_Release(OH_ImagePackerNative *imagePacker);
  */
 Image_ErrorCode OH_ImagePackerNative_GetSupportedFormats(Image_MimeType** supportedFormats, size_t* length);
 
+/**
+ * @brief 流式编码时一段编码数据就绪的回调函数。
+ * 数据仅在回调期间有效，需要在回调返回前拷贝或写出。
+ *
+ * @param data 指向编码数据段的指针。
+ * @param size 数据段大小，单位为字节。
+ * @param userData 指向用户特定数据的指针。
+ * @return true表示继续编码；false表示中止编码，此时打包接口返回IMAGE_ENCODE_FAILED。
+ * @since 26.1.0
+ */
+typedef bool (*OH_ImagePackerNative_OnDataChunk)(const uint8_t *data, size_t size, void *userData);
+
+/**
+ * @brief 设置编码单张图片使用的最大线程数。
+ * 对于支持的格式（例如带重启标记的JPEG、分块的HEIF），图片被切分为条带或分块并行编码；其他格式仍使用单线程编码。
+ *
+ * @param options 被操作的OH_PackingOptions指针。
+ * @param threadCount 最大编码线程数。取值为0表示由系统根据CPU核数决定。默认值为1。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_PACKER_INVALID_PARAMETER：options为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PackingOptions_SetEncodingThreadCount(OH_PackingOptions *options, uint32_t threadCount);
+
+/**
+ * @brief 获取编码单张图片使用的最大线程数。
+ *
+ * @param options 被操作的OH_PackingOptions指针。
+ * @param threadCount 指向最大编码线程数的指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_PACKER_INVALID_PARAMETER：options或threadCount为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PackingOptions_GetEncodingThreadCount(OH_PackingOptions *options, uint32_t *threadCount);
+
+/**
+ * @brief 设置流式编码时输出编码数据的分段大小。
+ * 作用于{@link OH_ImagePackerNative_PackToStreamFromPixelmap}以及编码到文件的接口。每个编码线程在内存中最多保留约一个分段的输出。
+ *
+ * @param options 被操作的OH_PackingOptions指针。
+ * @param chunkSize 分段大小，单位为字节。取值为0表示由系统决定。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_PACKER_INVALID_PARAMETER：options为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PackingOptions_SetOutputChunkSize(OH_PackingOptions *options, size_t chunkSize);
+
+/**
+ * @brief 获取流式编码时输出编码数据的分段大小。
+ *
+ * @param options 被操作的OH_PackingOptions指针。
+ * @param chunkSize 分段大小的指针，单位为字节。取值为0表示由系统决定。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_PACKER_INVALID_PARAMETER：options或chunkSize为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PackingOptions_GetOutputChunkSize(OH_PackingOptions *options, size_t *chunkSize);
+
+/**
+ * @brief 编码PixelMap，并通过回调分段输出编码数据。
+ * 内存中不会保存完整的编码结果，可在有限内存下导出大图。回调在调用线程中按输出顺序触发。最后一段数据输出后该接口才返回。
+ *
+ * @param imagePacker 被操作的OH_ImagePackerNative指针。
+ * @param options 打包选项参数 OH_PackingOptions。
+ * @param pixelmap 用于编码的PixelMap。
+ * @param callback 每段编码数据的回调函数，详细说明请参见{@link OH_ImagePackerNative_OnDataChunk}。
+ * @param userData 指向用户特定数据的指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_PACKER_INVALID_PARAMETER：imagePacker、options、pixelmap或callback为空指针。
+ *     <br>IMAGE_ENCODE_FAILED：编码失败，或者回调中止了编码。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImagePackerNative_PackToStreamFromPixelmap(OH_ImagePackerNative *imagePacker,
+    OH_PackingOptions *options, OH_PixelmapNative *pixelmap, OH_ImagePackerNative_OnDataChunk callback,
+    void *userData);
+
+/**
+ * @brief 设置编码器对象是否在多次打包调用之间保留编码器实例。
+ * 使能后，格式、质量和动态范围相同的连续调用复用同一编码器实例，而不是每次调用都新建。选项变化或编码器对象释放时，缓存的实例被释放。
+ *
+ * @param imagePacker 被操作的OH_ImagePackerNative指针。
+ * @param enabled 是否保留编码器实例。默认值为false。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_PACKER_INVALID_PARAMETER：imagePacker为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImagePackerNative_SetEncoderCacheEnabled(OH_ImagePackerNative *imagePacker, bool enabled);
+
 #ifdef __cplusplus
 };
 #endif
@@ -1232,6 +1232,252 @@ Image_ErrorCode OH_ImageSourceNative_GetBitsPerPixelFromRawData(const OH_ImageRa
  */
 Image_ErrorCode OH_ImageSourceNative_DestroyImageRawData(OH_ImageRawData *rawData);
 
+/**
+ * @brief 图片源的分块解码器。
+ * 分块解码器只解析一次图片源并保存解析后的码流状态，可对大图的任意区域反复解码而无需重新解析图片源。
+ * 通过{@link OH_ImageSourceNative_CreateTileDecoder}创建。
+ *
+ * @since 26.1.0
+ */
+struct OH_ImageSourceTileDecoder;
+
+/**
+ * @brief 图片源的分块解码器。
+ * 通过{@link OH_ImageSourceNative_CreateTileDecoder}创建。
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_ImageSourceTileDecoder OH_ImageSourceTileDecoder;
+
+/**
+ * @brief 分块的一个渐进解码遍完成时的回调函数。
+ * 对于渐进式JPEG图片，每一遍对应一次扫描；对于隔行扫描PNG图片，每一遍对应一个Adam7遍。
+ * 分块在原位逐步细化，每次回调传入的是同一个pixelmap。
+ *
+ * @param decoder 指向OH_ImageSourceTileDecoder对象的指针。
+ * @param passIndex 已完成解码的遍序号，从0开始。
+ * @param passCount 图片的总遍数。
+ * @param pixelmap 指向被该遍细化的分块pixelmap的指针，由{@link OH_ImageSourceTileDecoder_DecodeTileProgressive}的调用方持有。
+ * @param userData 指向用户特定数据的指针。
+ * @since 26.1.0
+ */
+typedef void (*OH_ImageSourceTileDecoder_OnPassDecoded)(OH_ImageSourceTileDecoder *decoder, uint32_t passIndex,
+    uint32_t passCount, OH_PixelmapNative *pixelmap, void *userData);
+
+/**
+ * @brief 为图片源创建分块解码器。
+ * 创建分块解码器时只解析一次图片源。分块解码器持有对图片源的引用，在分块解码器释放之前不能释放图片源。
+ *
+ * @param source 指向OH_ImageSourceNative对象的指针。
+ * @param decoder 指向创建的OH_ImageSourceTileDecoder对象的二级指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：source或decoder为空指针。
+ *     <br>IMAGE_BAD_SOURCE：图片源解析失败。
+ *     <br>IMAGE_SOURCE_UNSUPPORTED_MIME_TYPE：图片格式不支持分块解码。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceNative_CreateTileDecoder(OH_ImageSourceNative *source,
+    OH_ImageSourceTileDecoder **decoder);
+
+/**
+ * @brief 获取分块解码器支持的缩放级别数。
+ * 级别0为原始尺寸，之后每一级的宽和高均为上一级的一半。编解码器可直接产生的级别（例如JPEG图片的DCT域降采样）无需解码全分辨率数据。
+ *
+ * @param decoder 指向OH_ImageSourceTileDecoder对象的指针。
+ * @param levelCount 指向获取到的缩放级别数的指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：decoder或levelCount为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_GetScaleLevelCount(OH_ImageSourceTileDecoder *decoder,
+    uint32_t *levelCount);
+
+/**
+ * @brief 获取分块解码器在指定缩放级别下的图片尺寸。
+ *
+ * @param decoder 指向OH_ImageSourceTileDecoder对象的指针。
+ * @param level 缩放级别，取值范围为[0, levelCount)。
+ * @param size 指向该缩放级别下图片尺寸的指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：decoder或size为空指针，或者level超出范围。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_GetScaleLevelSize(OH_ImageSourceTileDecoder *decoder, uint32_t level,
+    Image_Size *size);
+
+/**
+ * @brief 按指定缩放级别解码图片的一个分块。
+ * 只解码覆盖该分块的数据。可在多个线程中对同一个分块解码器并发调用该接口，以并行解码不同的分块。
+ *
+ * @param decoder 指向OH_ImageSourceTileDecoder对象的指针。
+ * @param level 缩放级别，取值范围为[0, levelCount)。
+ * @param region 指向分块区域的指针，坐标基于该缩放级别下的图片。
+ * @param options 指向解码参数的指针，仅像素格式、内存分配器和动态范围参数生效。为空指针时使用默认参数。
+ * @param pixelmap 指向创建的OH_PixelmapNative对象的二级指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：decoder、region或pixelmap为空指针，或者level超出范围。
+ *     <br>IMAGE_INVALID_REGION：region超出该缩放级别下的图片范围。
+ *     <br>IMAGE_SOURCE_UNSUPPORTED_OPTIONS：不支持的解码参数。
+ *     <br>IMAGE_DECODE_FAILED：分块解码失败。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_DecodeTile(OH_ImageSourceTileDecoder *decoder, uint32_t level,
+    Image_Region *region, OH_DecodingOptions *options, OH_PixelmapNative **pixelmap);
+
+/**
+ * @brief 逐遍解码渐进式JPEG或隔行扫描PNG图片的一个分块。
+ * 每当一遍数据作用到分块上时同步触发回调，可在分块完全解码前显示粗略预览。对于没有渐进遍的图片，回调只触发一次。
+ *
+ * @param decoder 指向OH_ImageSourceTileDecoder对象的指针。
+ * @param level 缩放级别，取值范围为[0, levelCount)。
+ * @param region 指向分块区域的指针，坐标基于该缩放级别下的图片。
+ * @param callback 每一遍解码完成时的回调函数，详细说明请参见{@link OH_ImageSourceTileDecoder_OnPassDecoded}。
+ * @param userData 指向用户特定数据的指针。
+ * @param pixelmap 指向创建的OH_PixelmapNative对象的二级指针，保存完全解码后的分块。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：decoder、region、callback或pixelmap为空指针，或者level超出范围。
+ *     <br>IMAGE_INVALID_REGION：region超出该缩放级别下的图片范围。
+ *     <br>IMAGE_DECODE_FAILED：分块解码失败。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_DecodeTileProgressive(OH_ImageSourceTileDecoder *decoder, uint32_t level,
+    Image_Region *region, OH_ImageSourceTileDecoder_OnPassDecoded callback, void *userData,
+    OH_PixelmapNative **pixelmap);
+
+/**
+ * @brief 释放分块解码器及其保存的码流解析状态。
+ * 不会释放由该分块解码器创建的分块pixelmap。
+ *
+ * @param decoder 指向OH_ImageSourceTileDecoder对象的指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：decoder为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceTileDecoder_Release(OH_ImageSourceTileDecoder *decoder);
+
+/**
+ * @brief 批量生成缩略图的参数。
+ * 通过{@link OH_ThumbnailOptions_Create}创建。
+ *
+ * @since 26.1.0
+ */
+struct OH_ThumbnailOptions;
+
+/**
+ * @brief 批量生成缩略图的参数。
+ * 通过{@link OH_ThumbnailOptions_Create}创建。
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_ThumbnailOptions OH_ThumbnailOptions;
+
+/**
+ * @brief 批量中的一张缩略图生成完成时的回调函数。
+ * 回调在工作线程中触发，缩略图可能以任意顺序返回。
+ * 回调不会串行执行：最大并发数大于1时，回调可能在多个工作线程中并发执行，应用需自行对userData的访问进行同步。
+ * 工作线程在回调返回后才开始处理下一张图片，因此回调耗时过长也会拖慢整个批量处理。
+ *
+ * @param index 图片在输入数组中的序号。
+ * @param errorCode 缩略图生成结果，IMAGE_SUCCESS表示执行成功。
+ * @param pixelmap 指向缩略图的指针，生成失败时为空指针。缩略图的所有权转移给应用，不再使用时需调用{@link OH_PixelmapNative_Release}释放。
+ * @param userData 指向用户特定数据的指针。
+ * @since 26.1.0
+ */
+typedef void (*OH_ImageSourceNative_OnThumbnailCreated)(uint32_t index, Image_ErrorCode errorCode,
+    OH_PixelmapNative *pixelmap, void *userData);
+
+/**
+ * @brief 创建OH_ThumbnailOptions对象的指针。
+ *
+ * @param options 指向创建的OH_ThumbnailOptions对象的二级指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：options为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_Create(OH_ThumbnailOptions **options);
+
+/**
+ * @brief 设置期望的缩略图尺寸。
+ * 缩略图保持原图宽高比，并缩放到期望尺寸以内。该参数为必选参数。
+ *
+ * @param options 指向OH_ThumbnailOptions对象的指针。
+ * @param desiredSize 指向期望缩略图尺寸的指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：options或desiredSize为空指针，或者desiredSize为空尺寸。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_SetDesiredSize(OH_ThumbnailOptions *options, Image_Size *desiredSize);
+
+/**
+ * @brief 设置是否使用图片内嵌的缩略图，例如JPEG图片的EXIF缩略图。
+ * 仅当内嵌缩略图不小于期望尺寸时才会使用，否则使用编解码器提供的降采样能力解码图片，例如JPEG图片的DCT域降采样。
+ *
+ * @param options 指向OH_ThumbnailOptions对象的指针。
+ * @param preferEmbedded 是否使用内嵌缩略图，默认值为true。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：options为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_SetPreferEmbeddedThumbnail(OH_ThumbnailOptions *options, bool preferEmbedded);
+
+/**
+ * @brief 设置批量中同时解码的最大图片数。
+ * 用于限制批量处理占用的内存。默认值由系统根据CPU核数决定。
+ * 该限制针对正在处理的图片的解码工作内存。已通过{@link OH_ImageSourceNative_OnThumbnailCreated}返回的缩略图归应用所有，不计入其中，
+ * 只有应用及时释放或转交不再需要的缩略图，内存占用才能保持有界。
+ *
+ * @param options 指向OH_ThumbnailOptions对象的指针。
+ * @param maxConcurrency 同时解码的最大图片数，取值需大于0。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：options为空指针，或者maxConcurrency为0。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_SetMaxConcurrency(OH_ThumbnailOptions *options, uint32_t maxConcurrency);
+
+/**
+ * @brief 释放OH_ThumbnailOptions对象。
+ *
+ * @param options 指向OH_ThumbnailOptions对象的指针。
+ * @return IMAGE_SUCCESS：执行成功。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：options为空指针。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ThumbnailOptions_Release(OH_ThumbnailOptions *options);
+
+/**
+ * @brief 为一批通过URI指定的图片生成缩略图。
+ * 图片在工作线程池中解码，每张缩略图生成后立即通过回调返回。所有图片的回调均触发后该接口才返回。单张图片失败不会中止批量处理。
+ *
+ * @param uris 图片URI数组，URI格式与{@link OH_ImageSourceNative_CreateFromUri}相同。
+ * @param uriSizes URI长度数组。
+ * @param count 批量中的图片数量。
+ * @param options 指向OH_ThumbnailOptions对象的指针。
+ * @param callback 缩略图生成完成时的回调函数，详细说明请参见{@link OH_ImageSourceNative_OnThumbnailCreated}。
+ * @param userData 指向用户特定数据的指针。
+ * @return IMAGE_SUCCESS：批量处理完成。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：uris、uriSizes、options或callback为空指针，count为0，或者未设置期望尺寸。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceNative_CreateThumbnailsFromUris(char *uris[], size_t uriSizes[], size_t count,
+    OH_ThumbnailOptions *options, OH_ImageSourceNative_OnThumbnailCreated callback, void *userData);
+
+/**
+ * @brief 为一批通过文件描述符指定的图片生成缩略图。
+ * 图片在工作线程池中解码，每张缩略图生成后立即通过回调返回。所有图片的回调均触发后该接口才返回。单张图片失败不会中止批量处理。
+ * 接口不会关闭传入的文件描述符。
+ *
+ * @param fds 图片文件描述符数组。
+ * @param count 批量中的图片数量。
+ * @param options 指向OH_ThumbnailOptions对象的指针。
+ * @param callback 缩略图生成完成时的回调函数，详细说明请参见{@link OH_ImageSourceNative_OnThumbnailCreated}。
+ * @param userData 指向用户特定数据的指针。
+ * @return IMAGE_SUCCESS：批量处理完成。
+ *     <br>IMAGE_SOURCE_INVALID_PARAMETER：fds、options或callback为空指针，count为0，或者未设置期望尺寸。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_ImageSourceNative_CreateThumbnailsFromFds(int32_t fds[], size_t count,
+    OH_ThumbnailOptions *options, OH_ImageSourceNative_OnThumbnailCreated callback, void *userData);
+
 #ifdef __cplusplus
 };
 #endif
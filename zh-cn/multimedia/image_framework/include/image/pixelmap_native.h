@@ -1467,6 +1467,85 @@ Image_ErrorCode OH_PixelmapNative_GetUniqueId(OH_PixelmapNative *pixelmap, uint3
  */
 Image_ErrorCode OH_PixelmapNative_IsReleased(OH_PixelmapNative *pixelmap, bool *released);
 
+/**
+ * @brief 像素转换接口使用的像素缓冲区。
+ * 对于YUV格式{@link PIXEL_FORMAT_NV21}和{@link PIXEL_FORMAT_NV12}，色度平面紧跟在亮度平面之后，且使用相同的行跨距。
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_Pixelmap_PixelBuffer {
+    /** 像素数据。 */
+    uint8_t *pixels;
+    /** 像素数据长度，单位为字节。 */
+    size_t pixelsSize;
+    /** 图片宽度，单位为像素。 */
+    uint32_t width;
+    /** 图片高度，单位为像素。 */
+    uint32_t height;
+    /** 每行的字节数。取值为0时表示行与行之间紧密排列。 */
+    uint32_t rowStride;
+    /** 像素格式，详细说明请参见{@link PIXEL_FORMAT}。 */
+    PIXEL_FORMAT format;
+} OH_Pixelmap_PixelBuffer;
+
+/**
+ * @brief 一次性完成像素缓冲区的像素格式转换和尺寸缩放，结果写入另一个像素缓冲区。
+ * 源缓冲区和目标缓冲区不能重叠。目标尺寸与源尺寸不同时，使用指定的滤波方式重采样。
+ * 设备支持时使用向量指令加速转换，转换结果与是否使用向量指令无关。
+ *
+ * @param src 指向源像素缓冲区的指针。
+ * @param dst 指向目标像素缓冲区的指针，由调用方分配。
+ * @param level 缩放使用的滤波方式，详细说明请参见{@link OH_PixelmapNative_AntiAliasingLevel}。
+ * @return 函数结果返回码：
+ *         IMAGE_SUCCESS：执行成功。
+ *         IMAGE_INVALID_PARAMETER：src或dst为空指针，缓冲区大小不满足其尺寸和跨距，或者缓冲区重叠。
+ *         IMAGE_UNSUPPORTED_CONVERSION：不支持两种像素格式之间的转换。
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PixelmapNative_ConvertPixels(const OH_Pixelmap_PixelBuffer *src, OH_Pixelmap_PixelBuffer *dst,
+    OH_PixelmapNative_AntiAliasingLevel level);
+
+/**
+ * @brief 将PixelMap的一个区域转换为调用方提供的像素缓冲区的像素格式和尺寸。
+ * 不会修改PixelMap。
+ *
+ * @param pixelmap 指向源PixelMap的指针。
+ * @param region 指向源区域的指针。为空指针时转换整个PixelMap。
+ * @param dst 指向目标像素缓冲区的指针，由调用方分配。
+ * @param level 缩放使用的滤波方式，详细说明请参见{@link OH_PixelmapNative_AntiAliasingLevel}。
+ * @return 函数结果返回码：
+ *         IMAGE_SUCCESS：执行成功。
+ *         IMAGE_INVALID_PARAMETER：pixelmap或dst为空指针，或者dst大小不满足其尺寸和跨距。
+ *         IMAGE_INVALID_REGION：region超出PixelMap范围。
+ *         IMAGE_PIXELMAP_RELEASED：PixelMap已被释放。
+ *         IMAGE_UNSUPPORTED_CONVERSION：不支持两种像素格式之间的转换。
+ * @see OH_PixelmapNative
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PixelmapNative_ConvertToBuffer(OH_PixelmapNative *pixelmap, Image_Region *region,
+    OH_Pixelmap_PixelBuffer *dst, OH_PixelmapNative_AntiAliasingLevel level);
+
+/**
+ * @brief 将PixelMap的一个区域转换为OH_NativeBuffer的像素格式和尺寸。
+ * 目标格式、尺寸和跨距取自OH_NativeBuffer的配置。不会修改PixelMap。
+ *
+ * @param pixelmap 指向源PixelMap的指针。
+ * @param region 指向源区域的指针。为空指针时转换整个PixelMap。
+ * @param nativeBuffer 指向目标OH_NativeBuffer的指针。
+ * @param level 缩放使用的滤波方式，详细说明请参见{@link OH_PixelmapNative_AntiAliasingLevel}。
+ * @return 函数结果返回码：
+ *         IMAGE_SUCCESS：执行成功。
+ *         IMAGE_INVALID_PARAMETER：pixelmap或nativeBuffer为空指针。
+ *         IMAGE_INVALID_REGION：region超出PixelMap范围。
+ *         IMAGE_PIXELMAP_RELEASED：PixelMap已被释放。
+ *         IMAGE_UNSUPPORTED_CONVERSION：不支持OH_NativeBuffer的像素格式。
+ *         IMAGE_LOCK_UNLOCK_FAILED：OH_NativeBuffer映射失败。
+ * @see OH_PixelmapNative
+ * @since 26.1.0
+ */
+Image_ErrorCode OH_PixelmapNative_ConvertToNativeBuffer(OH_PixelmapNative *pixelmap, Image_Region *region,
+    OH_NativeBuffer *nativeBuffer, OH_PixelmapNative_AntiAliasingLevel level);
+
 #ifdef __cplusplus
 };
 #endif
@@ -326,6 +326,50 @@ OH_AVErrCode OH_AVTranscoder_SetProgressUpdateCallback(
  */
 OH_AVErrCode OH_AVTranscoderConfig_EnableBFrame(OH_AVTranscoder_Config *config, bool enabled);
 
+/**
+ * @brief 设置并行转码的最大分段数。
+ * 取值大于1时，源视频按关键帧（GOP）边界切分，每个分段由独立的解码器和编码器并行转码，
+ * 转码后的分段按顺序写入输出文件，时间戳保持连续。实际分段数可能小于设置值，取决于源文件时长、关键帧间隔和可用的编解码器实例。
+ * 未调用该接口或取值为1时，按串行方式转码。
+ * 需要在{@link OH_AVTranscoder_Prepare}之前调用。
+ *
+ * @param config 指向OH_AVTranscoder_Config实例的指针。
+ * @param segmentCount 并行转码的最大分段数，取值需大于0。
+ * @return AV_ERR_OK：设置成功。
+ * AV_ERR_INVALID_VAL：输入的config为空指针，或者segmentCount取值无效。
+ * @since 26.1.0
+ */
+OH_AVErrCode OH_AVTranscoderConfig_SetParallelSegmentCount(OH_AVTranscoder_Config *config, int32_t segmentCount);
+
+/**
+ * @brief 设置并行分段转码的最小分段时长。
+ * 分段只在关键帧处切分，除最后一个分段外，每个分段的实际时长不小于该值。取值越大，短视频的切分与拼接开销越小。
+ * 仅当{@link OH_AVTranscoderConfig_SetParallelSegmentCount}设置的值大于1时生效，需要在{@link OH_AVTranscoder_Prepare}之前调用。
+ *
+ * @param config 指向OH_AVTranscoder_Config实例的指针。
+ * @param durationMs 最小分段时长，单位为毫秒，取值需大于0。
+ * @return AV_ERR_OK：设置成功。
+ * AV_ERR_INVALID_VAL：输入的config为空指针，或者durationMs取值无效。
+ * @since 26.1.0
+ */
+OH_AVErrCode OH_AVTranscoderConfig_SetMinSegmentDuration(OH_AVTranscoder_Config *config, int64_t durationMs);
+
+/**
+ * @brief 注册并行分段转码的分段进度更新事件的回调方法。
+ * 当某个分段的转码进度更新时，通过注册的回调方法通知开发者。串行转码时不会触发该回调。
+ * 开发者只能注册一个分段进度更新事件的回调方法，当开发者重复注册时，以最后一次注册的回调接口为准。
+ * 若开发者需监听分段进度，则须在{@link OH_AVTranscoder_Prepare}之前注册该事件。
+ *
+ * @param transcoder 指向OH_AVTranscoder实例的指针。
+ * @param callback 分段进度更新回调方法，详细说明请参见{@link OH_AVTranscoder_OnSegmentProgressUpdate}。
+ * @param userData 指向用户特定数据的指针。
+ * @return AV_ERR_OK：注册成功。
+ * AV_ERR_INVALID_VAL：输入的transcoder是空指针，或者callback是空指针。
+ * @since 26.1.0
+ */
+OH_AVErrCode OH_AVTranscoder_SetSegmentProgressUpdateCallback(
+    OH_AVTranscoder *transcoder, OH_AVTranscoder_OnSegmentProgressUpdate callback, void *userData);
+
 #ifdef __cplusplus
 }
 #endif
@@ -124,6 +124,21 @@ typedef void (*OH_AVTranscoder_OnError)(OH_AVTranscoder *transcoder, int32_t err
  */
 typedef void (*OH_AVTranscoder_OnProgressUpdate)(OH_AVTranscoder *transcoder, int32_t progress, void *userData);
 
+/**
+ * @brief 并行分段转码中单个分段的转码进度更新时的回调函数。
+ * 通过{@link OH_AVTranscoderConfig_SetParallelSegmentCount}使能并行分段转码后，源文件按关键帧（GOP）边界切分，
+ * 各分段独立转码。该回调上报每个分段的进度，{@link OH_AVTranscoder_OnProgressUpdate}仍上报整体进度。
+ *
+ * @param transcoder OH_AVTranscoder实例的指针。
+ * @param segmentIndex 分段索引，从0开始。
+ * @param segmentCount 源文件被切分的分段总数。
+ * @param progress 该分段的转码进度，单位为百分比。
+ * @param userData 用户特定数据的指针。
+ * @since 26.1.0
+ */
+typedef void (*OH_AVTranscoder_OnSegmentProgressUpdate)(OH_AVTranscoder *transcoder, int32_t segmentIndex,
+    int32_t segmentCount, int32_t progress, void *userData);
+
 #ifdef __cplusplus
 }
 #endif